@@ -1,8 +1,11 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "glwrap/include_gl.h"
+#include "glwrap/features.hpp"
 #include "glwrap/object.hpp"
 
 namespace glwrap
@@ -17,19 +20,88 @@ namespace glwrap
 template <GLenum _target, GLenum _binding>
 class Buffer : public Object<_binding>
 {
+  protected:
+    using Object<_binding>::m_handle;
+    using Object<_binding>::Cached;
+    using Object<_binding>::Track;
+    using Object<_binding>::Forget;
+
+    bool m_direct = false;
+
   public:
     static constexpr GLenum TARGET = _target;
 
-    Buffer() { glGenBuffers(1, &m_handle); }
-    ~Buffer() { glDeleteBuffers(1, &m_handle); }
+    Buffer()
+    {
+#ifdef GLWRAP_DSA
+        if (Features::DirectStateAccess())
+        {
+            glCreateBuffers(1, &m_handle);
+            m_direct = true;
+            return;
+        }
+#endif
+        glGenBuffers(1, &m_handle);
+    }
+    ~Buffer()
+    {
+        Forget(m_handle);
+        glDeleteBuffers(1, &m_handle);
+    }
 
     /// @warning Deleted to prevent double deletion, use `std::unique_ptr` instead
     Buffer(const Buffer& other) = delete;
     Buffer& operator=(const Buffer& other) = delete;
     Buffer(Buffer&& other) = delete;
 
-    void Bind() const { glBindBuffer(TARGET, m_handle); }
-    void Unbind() const { glBindBuffer(TARGET, 0); }
+    /**
+     * @brief Returns whether the buffer was created with `glCreateBuffers` and is edited with
+     * direct state access, decided once when it is created
+     */
+    inline bool IsDirect() const { return m_direct; }
+
+
+    /// @note Binding is skipped if the buffer is already bound
+    void Bind() const
+    {
+        if (Track(m_handle)) glBindBuffer(TARGET, m_handle);
+    }
+    void Unbind() const
+    {
+        if (Track(0)) glBindBuffer(TARGET, 0);
+    }
+
+    /**
+     * @brief Binds the buffer to an indexed binding point
+     * @see glBindBufferBase
+     *
+     * @param index The index of the binding point, e.g. a uniform block binding
+     *
+     * @note Only valid for indexed targets, e.g. `GL_UNIFORM_BUFFER`
+     * @note This also binds the buffer to its target
+     */
+    void BindBase(GLuint index) const
+    {
+        glBindBufferBase(TARGET, index, m_handle);
+        Cached().Set(m_handle);
+    }
+
+    /**
+     * @brief Binds a range of the buffer to an indexed binding point
+     * @see glBindBufferRange
+     *
+     * @param index The index of the binding point, e.g. a uniform block binding
+     * @param offset The offset of the range in bytes, respecting the target's offset alignment
+     * @param size The size of the range in bytes
+     *
+     * @note Only valid for indexed targets, e.g. `GL_UNIFORM_BUFFER`
+     * @note This also binds the buffer to its target
+     */
+    void BindRange(GLuint index, GLintptr offset, GLsizeiptr size) const
+    {
+        glBindBufferRange(TARGET, index, m_handle, offset, size);
+        Cached().Set(m_handle);
+    }
 
     /**
      * @brief Creates and writes to the buffer's data storage
@@ -39,10 +111,17 @@ class Buffer : public Object<_binding>
      * @param usage The expected usage of the data
      * @param data The initial data or `nullptr` to leave uninitialized
      *
-     * @note This function binds the buffer
+     * @note This function binds the buffer unless direct state access is used
      */
     void Store(GLsizeiptr size, GLenum usage, const void* data)
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glNamedBufferData(m_handle, size, data, usage);
+            return;
+        }
+#endif
         Bind();
         glBufferData(TARGET, size, data, usage);
     }
@@ -53,6 +132,31 @@ class Buffer : public Object<_binding>
         Store(size, usage, nullptr);
     }
 
+#ifdef GL_VERSION_4_4
+    /**
+     * @brief Creates an immutable data store
+     * @see glBufferStorage
+     *
+     * @param size The size in bytes of the buffer
+     * @param flags The intended usage of the data store, e.g. `GL_MAP_PERSISTENT_BIT`
+     * @param data The initial data or `nullptr` to leave uninitialized
+     *
+     * @note This function binds the buffer unless direct state access is used
+     */
+    void Storage(GLsizeiptr size, GLbitfield flags, const void* data)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glNamedBufferStorage(m_handle, size, data, flags);
+            return;
+        }
+#endif
+        Bind();
+        glBufferStorage(TARGET, size, data, flags);
+    }
+#endif
+
     /**
      * @brief Replaces a subset of the buffer's data store
      * @see glBufferSubData
@@ -61,37 +165,110 @@ class Buffer : public Object<_binding>
      * @param data The new data to be copied into the data store
      * @param size The size in bytes of the data being overwritten
      *
-     * @note This function binds the buffer
+     * @note This function binds the buffer unless direct state access is used
      */
     void Write(GLintptr offset, const void* data, GLsizeiptr size)
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glNamedBufferSubData(m_handle, offset, size, data);
+            return;
+        }
+#endif
         Bind();
         glBufferSubData(TARGET, offset, size, data);
     }
 
     /**
-     * @brief Gets a subset of the buffer's data store
+     * @brief Gets a subset of the buffer's data store into caller-provided storage
      * @see glGetBufferSubData
      *
      * @param offset The offset into the buffer object's data, in bytes
      * @param size The size in bytes of the data being retrieved
-     * @return A pointer to the data, allocated with `new`
+     * @param data The storage to copy the data into, at least `size` bytes
      *
-     * @note This function binds the buffer
+     * @note This function binds the buffer unless direct state access is used
      */
-    void* Get(GLintptr offset, GLsizeiptr size)
+    void Get(GLintptr offset, GLsizeiptr size, void* data) const
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glGetNamedBufferSubData(m_handle, offset, size, data);
+            return;
+        }
+#endif
         Bind();
-        void* data = new char[size];
         glGetBufferSubData(TARGET, offset, size, data);
+    }
+
+    /**
+     * @brief Gets a subset of the buffer's data store into a vector
+     *
+     * @tparam T The element type of the data
+     * @param first The index of the first element
+     * @param count The number of elements being retrieved
+     * @param data The vector to copy the data into, resized to `count`
+     *
+     * @note The vector's capacity is reused, keep it around to avoid allocating
+     */
+    template <typename T>
+    void GetElements(GLintptr first, GLsizeiptr count, std::vector<T>& data) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+        data.resize(count);
+        Get(first * sizeof(T), count * sizeof(T), static_cast<void*>(data.data()));
+    }
+
+    /**
+     * @brief Gets a subset of the buffer's data store as typed elements
+     *
+     * @tparam T The element type of the data
+     * @param first The index of the first element
+     * @param count The number of elements being retrieved
+     * @return The data
+     */
+    template <typename T>
+    std::unique_ptr<T[]> GetElements(GLintptr first, GLsizeiptr count) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+        std::unique_ptr<T[]> data(new T[count]);
+        Get(first * sizeof(T), count * sizeof(T), static_cast<void*>(data.get()));
+        return data;
+    }
+
+    /**
+     * @brief An alias for `GetElements<T>(0, Size() / sizeof(T))`
+     * @return The data
+     */
+    template <typename T>
+    inline std::unique_ptr<T[]> GetElements() const { return GetElements<T>(0, Size() / sizeof(T)); }
+
+    /**
+     * @brief Gets a subset of the buffer's data store
+     * @see glGetBufferSubData
+     *
+     * @param offset The offset into the buffer object's data, in bytes
+     * @param size The size in bytes of the data being retrieved
+     * @return A pointer to the data, allocated with `new char[]`
+     *
+     * @note Prefer `GetElements`, which does not leave freeing to the caller
+     */
+    void* Get(GLintptr offset, GLsizeiptr size) const
+    {
+        void* data = new char[size];
+        Get(offset, size, data);
         return data;
     }
 
     /**
      * @brief An alias for `Get(0, Size())`
-     * @return A pointer to the data, allocated with `new`
+     * @return A pointer to the data, allocated with `new char[]`
      */
-    inline void* Get() { return Get(0, Size()); }
+    inline void* Get() const { return Get(0, Size()); }
 
     /**
      * @brief Maps the buffer's data store into the client's address space
@@ -100,22 +277,74 @@ class Buffer : public Object<_binding>
      * @param access The access policy
      * @return A pointer to the data
      *
-     * @note This function binds the buffer
+     * @note This function binds the buffer unless direct state access is used
      */
     void* Map(GLenum access)
     {
+#ifdef GLWRAP_DSA
+        if (m_direct) return glMapNamedBuffer(m_handle, access);
+#endif
         Bind();
         return glMapBuffer(TARGET, access);
     }
 
+    /**
+     * @brief Maps a range of the buffer's data store into the client's address space
+     * @see glMapBufferRange
+     *
+     * @param offset The offset into the buffer object's data, in bytes
+     * @param length The length of the range in bytes
+     * @param access The access flags, e.g. `GL_MAP_WRITE_BIT`
+     * @return A pointer to the data
+     *
+     * @note This function binds the buffer unless direct state access is used
+     */
+    void* MapRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct) return glMapNamedBufferRange(m_handle, offset, length, access);
+#endif
+        Bind();
+        return glMapBufferRange(TARGET, offset, length, access);
+    }
+
+    /**
+     * @brief Flushes a range of a mapping made with `GL_MAP_FLUSH_EXPLICIT_BIT`
+     * @see glFlushMappedBufferRange
+     *
+     * @param offset The offset into the mapped range, in bytes
+     * @param length The length of the range in bytes
+     *
+     * @note This function binds the buffer unless direct state access is used
+     */
+    void FlushRange(GLintptr offset, GLsizeiptr length)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glFlushMappedNamedBufferRange(m_handle, offset, length);
+            return;
+        }
+#endif
+        Bind();
+        glFlushMappedBufferRange(TARGET, offset, length);
+    }
+
     /**
      * @brief Unmaps the buffer's data store
      * @see glUnmapBuffer
      *
-     * @note This function binds the buffer
+     * @note This function binds the buffer unless direct state access is used
      */
     void Unmap()
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glUnmapNamedBuffer(m_handle);
+            return;
+        }
+#endif
         Bind();
         glUnmapBuffer(TARGET);
     }
@@ -124,12 +353,19 @@ class Buffer : public Object<_binding>
      * @brief Returns the size of the buffer's data store in bytes
      * @see glGetBufferParameteriv
      *
-     * @note This function binds the buffer
+     * @note This function binds the buffer unless direct state access is used
      */
     GLsizeiptr Size() const
     {
-        Bind();
         GLint size;
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glGetNamedBufferParameteriv(m_handle, GL_BUFFER_SIZE, &size);
+            return size;
+        }
+#endif
+        Bind();
         glGetBufferParameteriv(TARGET, GL_BUFFER_SIZE, &size);
         return size;
     }
@@ -147,6 +383,24 @@ using PixelPackBuffer = Buffer<GL_PIXEL_PACK_BUFFER, GL_PIXEL_PACK_BUFFER_BINDIN
 /// @brief A buffer with target `GL_PIXEL_UNPACK_BUFFER` and binding `GL_PIXEL_UNPACK_BUFFER_BINDING`
 using PixelUnpackBuffer = Buffer<GL_PIXEL_UNPACK_BUFFER, GL_PIXEL_UNPACK_BUFFER_BINDING>;
 
+#ifdef GL_VERSION_3_1
+/// @brief A buffer with target `GL_UNIFORM_BUFFER` and binding `GL_UNIFORM_BUFFER_BINDING`
+using UniformBuffer = Buffer<GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING>;
+#endif
+
+#ifdef GL_VERSION_4_0
+/// @brief A buffer with target `GL_DRAW_INDIRECT_BUFFER` and binding `GL_DRAW_INDIRECT_BUFFER_BINDING`
+using DrawIndirectBuffer = Buffer<GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING>;
+#endif
+
+#ifdef GL_VERSION_4_3
+/// @brief A buffer with target `GL_SHADER_STORAGE_BUFFER` and binding `GL_SHADER_STORAGE_BUFFER_BINDING`
+using ShaderStorageBuffer = Buffer<GL_SHADER_STORAGE_BUFFER, GL_SHADER_STORAGE_BUFFER_BINDING>;
+
+/// @brief A buffer with target `GL_DISPATCH_INDIRECT_BUFFER` and binding `GL_DISPATCH_INDIRECT_BUFFER_BINDING`
+using DispatchIndirectBuffer = Buffer<GL_DISPATCH_INDIRECT_BUFFER, GL_DISPATCH_INDIRECT_BUFFER_BINDING>;
+#endif
+
 /// @brief A buffer with target `GL_TRANSFORM_FEEDBACK_BUFFER` and binding `GL_TRANSFORM_FEEDBACK_BUFFER_BINDING`
 using TransformFeedbackBuffer = Buffer<GL_TRANSFORM_FEEDBACK_BUFFER, GL_TRANSFORM_FEEDBACK_BUFFER_BINDING>;
 
@@ -0,0 +1,442 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+
+#ifndef GL_VERSION_3_2
+#error "OpenGL 3.2 is required to use CommandBuffer"
+#endif
+
+#include "glwrap/buffer.hpp"
+#include "glwrap/shader.hpp"
+#include "glwrap/texture.hpp"
+#include "glwrap/uniform.hpp"
+#include "glwrap/vertex_array.hpp"
+
+namespace glwrap
+{
+
+/**
+ * @brief Builds a sort key from the state a packet uses
+ *
+ * Packets sorted by this key are grouped by program first, then by vertex
+ * array and texture set, and drawn front to back within a group.
+ *
+ * @param program An id of the program, e.g. its handle
+ * @param vertexArray An id of the vertex array
+ * @param textures An id of the set of textures
+ * @param depth The quantized view depth
+ */
+constexpr uint64_t MakeSortKey(uint16_t program, uint16_t vertexArray, uint16_t textures, uint16_t depth)
+{
+    return (static_cast<uint64_t>(program) << 48) | (static_cast<uint64_t>(vertexArray) << 32)
+        | (static_cast<uint64_t>(textures) << 16) | depth;
+}
+
+/**
+ * @brief Records GL work to be sorted and submitted later
+ *
+ * Commands are recorded into packets, each started with `Begin(key)`, and
+ * stored in a linear arena without calling GL, so a buffer can be recorded
+ * on any thread. `Submit()` then replays the packets in order of their keys
+ * on the GL thread. Binds go through the binding cache, so state shared by
+ * consecutive packets is only set once.
+ *
+ * As sorting reorders the packets, the state a packet finds when it is
+ * replayed is whatever the packet before it left behind. Each packet must
+ * therefore be self-contained: record the program, vertex array, textures
+ * and uniforms its draws use in the packet itself. Debug builds assert that
+ * a packet uses a program and binds a vertex array before it draws.
+ *
+ * @note Recorded objects must stay alive until the buffer is submitted
+ * @warning A buffer must only be recorded by one thread at a time, record
+ * one buffer per thread and `Append` them instead
+ */
+class CommandBuffer
+{
+  protected:
+    enum class Type : uint32_t
+    {
+        UseProgram,
+        BindVertexArray,
+        BindTexture,
+        Uniform,
+        ManagerUniform,
+        Write,
+        Draw,
+        DrawIndexed,
+    };
+
+    struct Header
+    {
+        Type type;
+        /// @brief The size of the command including the header, in words
+        uint32_t words;
+    };
+
+    struct UseProgramCommand { const Program* program; };
+    struct BindVertexArrayCommand { const VertexArray* vao; };
+
+    struct BindTextureCommand
+    {
+        const void* texture;
+        void (*bind)(const void* texture, GLuint unit);
+        GLuint unit;
+    };
+
+    struct UniformCommand
+    {
+        GLint location;
+        GLenum type;
+        GLsizei count;
+    };
+
+    struct ManagerUniformCommand
+    {
+        ShaderManager* manager;
+        uint64_t hash;
+        bool (*set)(ShaderManager& manager, uint64_t hash, const void* data);
+    };
+
+    struct WriteCommand
+    {
+        void* buffer;
+        void (*write)(void* buffer, GLintptr offset, const void* data, GLsizeiptr size);
+        GLintptr offset;
+        GLsizeiptr size;
+    };
+
+    struct DrawCommand
+    {
+        GLenum mode;
+        GLint first;
+        GLsizei count;
+        GLsizei instances;
+    };
+
+    struct DrawIndexedCommand
+    {
+        GLenum mode;
+        GLsizei count;
+        GLenum type;
+        GLsizei instances;
+        size_t offset;
+        GLint baseVertex;
+    };
+
+    /// @brief The state a packet has recorded, checked before it draws
+    enum PacketState : uint32_t
+    {
+        UsesProgram = 1,
+        BindsVertexArray = 2,
+    };
+
+    struct Packet
+    {
+        uint64_t key;
+        /// @brief The range of the packet's commands in the arena, in words
+        size_t begin, end;
+        uint32_t state;
+    };
+
+    std::vector<uint64_t> m_arena = {};
+    std::vector<Packet> m_packets = {};
+    bool m_sorted = true;
+
+  public:
+    CommandBuffer() = default;
+
+    CommandBuffer(const CommandBuffer& other) = delete;
+    CommandBuffer& operator=(const CommandBuffer& other) = delete;
+    CommandBuffer(CommandBuffer&& other) = delete;
+
+    /// @brief Returns the number of packets
+    inline size_t Size() const { return m_packets.size(); }
+    inline bool Empty() const { return m_packets.empty(); }
+
+    /// @brief Returns the size of the recorded commands in bytes
+    inline size_t ArenaSize() const { return m_arena.size() * sizeof(uint64_t); }
+
+    /**
+     * @brief Starts a packet, later commands belong to it
+     *
+     * @param key The sort key of the packet, see `MakeSortKey`
+     */
+    void Begin(uint64_t key)
+    {
+        if (!m_packets.empty() && key < m_packets.back().key) m_sorted = false;
+        m_packets.push_back({key, m_arena.size(), m_arena.size(), 0});
+    }
+
+    /// @brief Records using a program
+    void Use(const Program& program)
+    {
+        Push<UseProgramCommand>(Type::UseProgram, 0) = {&program};
+    }
+
+    /// @brief Records binding a vertex array
+    void Bind(const VertexArray& vao)
+    {
+        Push<BindVertexArrayCommand>(Type::BindVertexArray, 0) = {&vao};
+    }
+
+    /**
+     * @brief Records binding a texture to a texture unit
+     *
+     * @param unit The zero-based texture unit
+     * @param texture The texture
+     */
+    template <GLenum _target, GLenum _binding>
+    void Bind(GLuint unit, const Texture<_target, _binding>& texture)
+    {
+        Push<BindTextureCommand>(Type::BindTexture, 0) = {&texture, &ApplyBindTexture<_target, _binding>, unit};
+    }
+
+    /**
+     * @brief Records setting uniform values of the program in use
+     * @see UploadUniform
+     *
+     * @param data The values, copied into the buffer
+     */
+    void SetUniform(GLint location, GLenum type, GLsizei count, const void* data)
+    {
+        size_t size = static_cast<size_t>(count) * GetUniformTypeSize(type);
+        Push<UniformCommand>(Type::Uniform, size, data) = {location, type, count};
+    }
+
+    /**
+     * @brief Records setting a uniform through a shader manager
+     * @see ShaderManager::Set
+     *
+     * @note Values already uploaded are skipped by the manager's shadow copy
+     */
+    template <typename T>
+    void SetUniform(ShaderManager& manager, uint64_t hash, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        Push<ManagerUniformCommand>(Type::ManagerUniform, sizeof(T), &value) = {&manager, hash, &ApplySet<T>};
+    }
+
+    /**
+     * @brief Records replacing a subset of a buffer's data store
+     * @see Buffer::Write
+     *
+     * @param data The new data, copied into the buffer
+     */
+    template <GLenum _target, GLenum _binding>
+    void Write(Buffer<_target, _binding>& buffer, GLintptr offset, const void* data, GLsizeiptr size)
+    {
+        Push<WriteCommand>(Type::Write, static_cast<size_t>(size), data) =
+            {&buffer, &ApplyWrite<_target, _binding>, offset, size};
+    }
+
+    /**
+     * @brief Records drawing vertices in order
+     * @see glDrawArraysInstanced
+     *
+     * @note The packet must have recorded a program and a vertex array
+     */
+    void Draw(GLenum mode, GLint first, GLsizei count, GLsizei instances = 1)
+    {
+        Push<DrawCommand>(Type::Draw, 0) = {mode, first, count, instances};
+    }
+
+    /**
+     * @brief Records drawing indexed vertices
+     * @see glDrawElementsInstancedBaseVertex
+     *
+     * @note The packet must have recorded a program and a vertex array
+     */
+    void DrawIndexed(
+        GLenum mode, GLsizei count, GLenum type, size_t offset = 0,
+        GLsizei instances = 1, GLint baseVertex = 0
+    )
+    {
+        Push<DrawIndexedCommand>(Type::DrawIndexed, 0) = {mode, count, type, instances, offset, baseVertex};
+    }
+
+    /**
+     * @brief Moves the packets of another buffer into this one
+     *
+     * @note The other buffer is reset
+     */
+    void Append(CommandBuffer& other)
+    {
+        size_t base = m_arena.size();
+        m_arena.insert(m_arena.end(), other.m_arena.begin(), other.m_arena.end());
+        for (Packet packet : other.m_packets)
+        {
+            packet.begin += base;
+            packet.end += base;
+            if (!m_packets.empty() && packet.key < m_packets.back().key) m_sorted = false;
+            m_packets.push_back(packet);
+        }
+        other.Reset();
+    }
+
+    /// @brief Sorts the packets by key, keeping the recorded order of equal keys
+    void Sort()
+    {
+        if (m_sorted) return;
+
+        std::stable_sort(m_packets.begin(), m_packets.end(),
+            [](const Packet& a, const Packet& b) { return a.key < b.key; });
+        m_sorted = true;
+    }
+
+    /**
+     * @brief Sorts and replays the packets
+     *
+     * @note Must be called on the GL thread, the buffer is kept for resubmission
+     */
+    void Submit()
+    {
+        Sort();
+        for (const Packet& packet : m_packets)
+        {
+            for (size_t at = packet.begin; at < packet.end;)
+            {
+                const Header& header = *reinterpret_cast<const Header*>(&m_arena[at]);
+                Execute(header.type, &m_arena[at + 1]);
+                at += header.words;
+            }
+        }
+    }
+
+    /// @brief Removes all packets, keeping the arena's memory
+    void Reset()
+    {
+        m_arena.clear();
+        m_packets.clear();
+        m_sorted = true;
+    }
+
+  protected:
+    static constexpr size_t Words(size_t bytes)
+    {
+        return (bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    }
+
+    template <typename C>
+    C& Push(Type type, size_t extra, const void* data = nullptr)
+    {
+        static_assert(std::is_trivially_copyable_v<C>);
+        static_assert(sizeof(Header) == sizeof(uint64_t));
+
+        // commands recorded before any `Begin` go into a packet with key 0
+        if (m_packets.empty()) Begin(0);
+
+        Packet& packet = m_packets.back();
+        if (type == Type::UseProgram) packet.state |= UsesProgram;
+        else if (type == Type::BindVertexArray) packet.state |= BindsVertexArray;
+        assert(
+            ((type != Type::Draw && type != Type::DrawIndexed) || packet.state == (UsesProgram | BindsVertexArray))
+            && "a packet must use a program and bind a vertex array before drawing"
+        );
+
+        size_t command = Words(sizeof(C));
+        size_t words = 1 + command + Words(extra);
+        size_t at = m_arena.size();
+        m_arena.resize(at + words);
+        packet.end = m_arena.size();
+
+        new (&m_arena[at]) Header{type, static_cast<uint32_t>(words)};
+        if (extra > 0) memcpy(&m_arena[at + 1 + command], data, extra);
+        return *new (&m_arena[at + 1]) C();
+    }
+
+    template <typename C>
+    static const C& Read(const uint64_t* command)
+    {
+        return *reinterpret_cast<const C*>(command);
+    }
+
+    template <typename C>
+    static const void* Data(const uint64_t* command)
+    {
+        return command + Words(sizeof(C));
+    }
+
+    static void Execute(Type type, const uint64_t* command)
+    {
+        switch (type)
+        {
+            case Type::UseProgram:
+                Read<UseProgramCommand>(command).program->Use();
+                break;
+            case Type::BindVertexArray:
+                Read<BindVertexArrayCommand>(command).vao->Bind();
+                break;
+            case Type::BindTexture:
+            {
+                const BindTextureCommand& bind = Read<BindTextureCommand>(command);
+                bind.bind(bind.texture, bind.unit);
+                break;
+            }
+            case Type::Uniform:
+            {
+                const UniformCommand& uniform = Read<UniformCommand>(command);
+                UploadUniform(uniform.location, uniform.type, uniform.count, Data<UniformCommand>(command));
+                break;
+            }
+            case Type::ManagerUniform:
+            {
+                const ManagerUniformCommand& uniform = Read<ManagerUniformCommand>(command);
+                uniform.set(*uniform.manager, uniform.hash, Data<ManagerUniformCommand>(command));
+                break;
+            }
+            case Type::Write:
+            {
+                const WriteCommand& write = Read<WriteCommand>(command);
+                write.write(write.buffer, write.offset, Data<WriteCommand>(command), write.size);
+                break;
+            }
+            case Type::Draw:
+            {
+                const DrawCommand& draw = Read<DrawCommand>(command);
+                if (draw.instances == 1) glDrawArrays(draw.mode, draw.first, draw.count);
+                else glDrawArraysInstanced(draw.mode, draw.first, draw.count, draw.instances);
+                break;
+            }
+            case Type::DrawIndexed:
+            {
+                const DrawIndexedCommand& draw = Read<DrawIndexedCommand>(command);
+                const void* offset = reinterpret_cast<const void*>(draw.offset);
+                if (draw.instances == 1 && draw.baseVertex == 0)
+                    glDrawElements(draw.mode, draw.count, draw.type, offset);
+                else
+                    glDrawElementsInstancedBaseVertex(draw.mode, draw.count, draw.type, offset, draw.instances, draw.baseVertex);
+                break;
+            }
+        }
+    }
+
+    template <GLenum _target, GLenum _binding>
+    static void ApplyBindTexture(const void* texture, GLuint unit)
+    {
+        static_cast<const Texture<_target, _binding>*>(texture)->Bind(unit);
+    }
+
+    template <typename T>
+    static bool ApplySet(ShaderManager& manager, uint64_t hash, const void* data)
+    {
+        T value;
+        memcpy(&value, data, sizeof(T));
+        return manager.Set(hash, value);
+    }
+
+    template <GLenum _target, GLenum _binding>
+    static void ApplyWrite(void* buffer, GLintptr offset, const void* data, GLsizeiptr size)
+    {
+        static_cast<Buffer<_target, _binding>*>(buffer)->Write(offset, data, size);
+    }
+};
+
+} // namespace glwrap
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+#include "glwrap/features.hpp"
+#include "glwrap/shader.hpp"
+
+namespace glwrap
+{
+
+/**
+ * @brief Compiles and links many shaders and programs without waiting on each
+ *
+ * Everything added to the batch is submitted to the driver immediately and
+ * its status is only queried once it is needed. With
+ * `Features::ParallelShaderCompile()` the driver compiles on its own threads,
+ * so `Poll()` can be called every frame of a loading screen until nothing is
+ * pending. Without it, `Poll()` and `Finish()` wait on each entry in turn.
+ *
+ * Shaders must be added before the programs they are attached to, and all
+ * objects must stay alive until they are finished.
+ */
+class CompileBatch
+{
+  protected:
+    struct Entry
+    {
+        void* object;
+        bool (*complete)(const void* object);
+        bool (*finish)(void* object, std::string* log);
+    };
+
+    std::vector<Entry> m_pending = {};
+    std::vector<std::string> m_errors = {};
+    size_t m_failed = 0;
+
+  public:
+    CompileBatch() = default;
+
+    CompileBatch(const CompileBatch& other) = delete;
+    CompileBatch& operator=(const CompileBatch& other) = delete;
+    CompileBatch(CompileBatch&& other) = delete;
+
+    /**
+     * @brief Sets the number of threads the driver may use to compile
+     * @see glMaxShaderCompilerThreadsKHR
+     *
+     * @param count The number of threads, `0xFFFFFFFF` for the driver's default
+     *
+     * @note Does nothing without `Features::ParallelShaderCompile()`
+     */
+    static void SetMaxThreads(GLuint count)
+    {
+        if (!Features::ParallelShaderCompile()) return;
+
+#if defined(GL_KHR_parallel_shader_compile)
+        if (Features::HasExtension("GL_KHR_parallel_shader_compile"))
+        {
+            glMaxShaderCompilerThreadsKHR(count);
+            return;
+        }
+#endif
+#if defined(GL_ARB_parallel_shader_compile)
+        glMaxShaderCompilerThreadsARB(count);
+#else
+        (void)count;
+#endif
+    }
+
+    /**
+     * @brief Submits a shader's compilation
+     * @see Shader::Submit
+     */
+    template <GLenum _type>
+    void Add(Shader<_type>& shader)
+    {
+        shader.Submit();
+        m_pending.push_back({&shader, &ShaderComplete<_type>, &ShaderFinish<_type>});
+    }
+
+    /**
+     * @brief Submits a program's link
+     * @see Program::SubmitLink
+     *
+     * @param program The program, e.g. a `Program` or `ShaderManager`
+     */
+    template <typename P>
+    void Add(P& program)
+    {
+        program.SubmitLink();
+        m_pending.push_back({&program, &ProgramComplete<P>, &ProgramFinish<P>});
+    }
+
+    /// @brief Returns the number of entries that are not finished
+    inline size_t Pending() const { return m_pending.size(); }
+
+    /// @brief Returns the number of entries that failed to compile or link
+    inline size_t Failed() const { return m_failed; }
+
+    /// @brief Returns the info logs of the entries that failed
+    inline const std::vector<std::string>& Errors() const { return m_errors; }
+
+    /**
+     * @brief Finishes the entries that are complete without waiting
+     *
+     * @return The number of entries that are still pending
+     */
+    size_t Poll()
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_pending.size(); i++)
+        {
+            Entry& entry = m_pending[i];
+            if (entry.complete(entry.object)) FinishEntry(entry);
+            else m_pending[kept++] = entry;
+        }
+        m_pending.resize(kept);
+        return kept;
+    }
+
+    /**
+     * @brief Finishes all entries, waiting for them if needed
+     *
+     * @return Whether everything compiled and linked successfully
+     */
+    bool Finish()
+    {
+        for (Entry& entry : m_pending) FinishEntry(entry);
+        m_pending.clear();
+        return m_failed == 0;
+    }
+
+  protected:
+    void FinishEntry(Entry& entry)
+    {
+        std::string log;
+        if (entry.finish(entry.object, &log)) return;
+
+        m_failed++;
+        m_errors.push_back(std::move(log));
+    }
+
+    template <GLenum _type>
+    static bool ShaderComplete(const void* object)
+    {
+        return static_cast<const Shader<_type>*>(object)->IsComplete();
+    }
+
+    template <GLenum _type>
+    static bool ShaderFinish(void* object, std::string* log)
+    {
+        Shader<_type>& shader = *static_cast<Shader<_type>*>(object);
+        if (shader.GetCompileStatus()) return true;
+
+        *log = shader.GetInfoLog();
+        return false;
+    }
+
+    template <typename P>
+    static bool ProgramComplete(const void* object)
+    {
+        return static_cast<const P*>(object)->IsLinkComplete();
+    }
+
+    template <typename P>
+    static bool ProgramFinish(void* object, std::string* log)
+    {
+        P& program = *static_cast<P*>(object);
+        if (program.FinishLink()) return true;
+
+        *log = program.GetInfoLog();
+        return false;
+    }
+};
+
+} // namespace glwrap
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+
+#ifndef GL_VERSION_3_0
+#error "OpenGL 3.0 is required to use the draw functions"
+#endif
+
+#include "glwrap/buffer.hpp"
+#include "glwrap/vertex_array.hpp"
+
+namespace glwrap
+{
+
+/**
+ * @brief Draws vertices in order
+ * @see glDrawArrays
+ *
+ * @param vao The vertex array to source vertices from
+ * @param mode The kind of primitives, e.g. `GL_TRIANGLES`
+ * @param first The index of the first vertex
+ * @param count The number of vertices
+ *
+ * @note This function binds the vertex array
+ */
+inline void Draw(const VertexArray& vao, GLenum mode, GLint first, GLsizei count)
+{
+    vao.Bind();
+    glDrawArrays(mode, first, count);
+}
+
+/**
+ * @brief Draws indexed vertices
+ * @see glDrawElements
+ *
+ * @param vao The vertex array to source vertices and indices from
+ * @param mode The kind of primitives, e.g. `GL_TRIANGLES`
+ * @param count The number of indices
+ * @param type The type of the indices, e.g. `GL_UNSIGNED_INT`
+ * @param offset The byte offset of the first index in the element buffer
+ *
+ * @note This function binds the vertex array
+ */
+inline void DrawIndexed(const VertexArray& vao, GLenum mode, GLsizei count, GLenum type, size_t offset = 0)
+{
+    vao.Bind();
+    glDrawElements(mode, count, type, reinterpret_cast<const void*>(offset));
+}
+
+#ifdef GL_VERSION_3_1
+/**
+ * @brief Draws instances of vertices in order
+ * @see glDrawArraysInstanced
+ *
+ * @param instances The number of instances
+ *
+ * @note This function binds the vertex array
+ */
+inline void DrawInstanced(const VertexArray& vao, GLenum mode, GLint first, GLsizei count, GLsizei instances)
+{
+    vao.Bind();
+    glDrawArraysInstanced(mode, first, count, instances);
+}
+
+/**
+ * @brief Draws instances of indexed vertices
+ * @see glDrawElementsInstanced
+ *
+ * @param instances The number of instances
+ *
+ * @note This function binds the vertex array
+ */
+inline void DrawIndexedInstanced(
+    const VertexArray& vao, GLenum mode, GLsizei count, GLenum type,
+    size_t offset, GLsizei instances
+)
+{
+    vao.Bind();
+    glDrawElementsInstanced(mode, count, type, reinterpret_cast<const void*>(offset), instances);
+}
+#endif
+
+#ifdef GL_VERSION_3_2
+/**
+ * @brief Draws indexed vertices, adding a constant to each index
+ * @see glDrawElementsBaseVertex
+ *
+ * @param baseVertex The value added to each index, e.g. the first vertex of a mesh in a shared buffer
+ *
+ * @note This function binds the vertex array
+ */
+inline void DrawElementsBaseVertex(
+    const VertexArray& vao, GLenum mode, GLsizei count, GLenum type,
+    size_t offset, GLint baseVertex
+)
+{
+    vao.Bind();
+    glDrawElementsBaseVertex(mode, count, type, reinterpret_cast<const void*>(offset), baseVertex);
+}
+
+/**
+ * @brief Draws instances of indexed vertices, adding a constant to each index
+ * @see glDrawElementsInstancedBaseVertex
+ *
+ * @note This function binds the vertex array
+ */
+inline void DrawElementsInstancedBaseVertex(
+    const VertexArray& vao, GLenum mode, GLsizei count, GLenum type,
+    size_t offset, GLsizei instances, GLint baseVertex
+)
+{
+    vao.Bind();
+    glDrawElementsInstancedBaseVertex(mode, count, type, reinterpret_cast<const void*>(offset), instances, baseVertex);
+}
+#endif
+
+#ifdef GL_VERSION_4_0
+/// @brief The layout of a command read by `glDrawArraysIndirect`
+struct DrawArraysIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    /// @note Must be 0 before GL 4.2
+    GLuint baseInstance;
+};
+
+/// @brief The layout of a command read by `glDrawElementsIndirect`
+struct DrawElementsIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    /// @note Must be 0 before GL 4.2
+    GLuint baseInstance;
+};
+
+/**
+ * @brief Draws vertices in order, with parameters read from a buffer
+ * @see glDrawArraysIndirect
+ *
+ * @param buffer The buffer holding a `DrawArraysIndirectCommand`
+ * @param offset The byte offset of the command in the buffer
+ *
+ * @note This function binds the vertex array and the buffer
+ */
+inline void DrawIndirect(const VertexArray& vao, GLenum mode, const DrawIndirectBuffer& buffer, size_t offset = 0)
+{
+    vao.Bind();
+    buffer.Bind();
+    glDrawArraysIndirect(mode, reinterpret_cast<const void*>(offset));
+}
+
+/**
+ * @brief Draws indexed vertices, with parameters read from a buffer
+ * @see glDrawElementsIndirect
+ *
+ * @param buffer The buffer holding a `DrawElementsIndirectCommand`
+ * @param offset The byte offset of the command in the buffer
+ *
+ * @note This function binds the vertex array and the buffer
+ */
+inline void DrawElementsIndirect(
+    const VertexArray& vao, GLenum mode, GLenum type,
+    const DrawIndirectBuffer& buffer, size_t offset = 0
+)
+{
+    vao.Bind();
+    buffer.Bind();
+    glDrawElementsIndirect(mode, type, reinterpret_cast<const void*>(offset));
+}
+#endif
+
+#ifdef GL_VERSION_4_3
+/**
+ * @brief Draws many sets of vertices in order with a single call
+ * @see glMultiDrawArraysIndirect
+ *
+ * @param buffer The buffer holding the `DrawArraysIndirectCommand`s
+ * @param offset The byte offset of the first command in the buffer
+ * @param drawCount The number of commands
+ * @param stride The byte offset between commands, 0 if tightly packed
+ *
+ * @note This function binds the vertex array and the buffer
+ */
+inline void MultiDrawArraysIndirect(
+    const VertexArray& vao, GLenum mode, const DrawIndirectBuffer& buffer,
+    size_t offset, GLsizei drawCount, GLsizei stride = 0
+)
+{
+    vao.Bind();
+    buffer.Bind();
+    glMultiDrawArraysIndirect(mode, reinterpret_cast<const void*>(offset), drawCount, stride);
+}
+
+/**
+ * @brief Draws many sets of indexed vertices with a single call
+ * @see glMultiDrawElementsIndirect
+ *
+ * @param buffer The buffer holding the `DrawElementsIndirectCommand`s
+ * @param offset The byte offset of the first command in the buffer
+ * @param drawCount The number of commands
+ * @param stride The byte offset between commands, 0 if tightly packed
+ *
+ * @note This function binds the vertex array and the buffer
+ */
+inline void MultiDrawElementsIndirect(
+    const VertexArray& vao, GLenum mode, GLenum type, const DrawIndirectBuffer& buffer,
+    size_t offset, GLsizei drawCount, GLsizei stride = 0
+)
+{
+    vao.Bind();
+    buffer.Bind();
+    glMultiDrawElementsIndirect(mode, type, reinterpret_cast<const void*>(offset), drawCount, stride);
+}
+
+/**
+ * @brief Collects indexed draws into `DrawElementsIndirectCommand`s for a single multi-draw
+ *
+ * Each command's index in the list is available to shaders as `gl_DrawID`.
+ */
+class DrawCommandBuilder
+{
+  protected:
+    std::vector<DrawElementsIndirectCommand> m_commands = {};
+
+  public:
+    inline size_t Size() const { return m_commands.size(); }
+    inline bool Empty() const { return m_commands.empty(); }
+    inline const DrawElementsIndirectCommand* Data() const { return m_commands.data(); }
+    inline GLsizeiptr ByteSize() const { return m_commands.size() * sizeof(DrawElementsIndirectCommand); }
+
+    /**
+     * @brief Adds a draw
+     *
+     * @param count The number of indices
+     * @param firstIndex The index of the first index in the element buffer
+     * @param baseVertex The value added to each index
+     * @param instanceCount The number of instances
+     * @param baseInstance The first instance, for instanced attributes
+     */
+    void Add(
+        GLuint count, GLuint firstIndex, GLint baseVertex = 0,
+        GLuint instanceCount = 1, GLuint baseInstance = 0
+    )
+    {
+        m_commands.push_back({count, instanceCount, firstIndex, baseVertex, baseInstance});
+    }
+
+    /// @brief Removes all draws
+    void Clear()
+    {
+        m_commands.clear();
+    }
+
+    /**
+     * @brief Writes the commands to a buffer, replacing its storage
+     * @see Buffer::Store
+     *
+     * @note Replacing the storage lets the driver orphan a buffer still in use
+     */
+    void Upload(DrawIndirectBuffer& buffer) const
+    {
+        buffer.Store(ByteSize(), GL_STREAM_DRAW, m_commands.data());
+    }
+
+    /**
+     * @brief Uploads the commands and draws them with a single call
+     * @see MultiDrawElementsIndirect
+     *
+     * @param vao The vertex array to source vertices and indices from
+     * @param buffer The buffer to upload the commands to
+     * @param mode The kind of primitives, e.g. `GL_TRIANGLES`
+     * @param type The type of the indices, e.g. `GL_UNSIGNED_INT`
+     */
+    void Submit(const VertexArray& vao, DrawIndirectBuffer& buffer, GLenum mode, GLenum type) const
+    {
+        if (m_commands.empty()) return;
+
+        Upload(buffer);
+        MultiDrawElementsIndirect(vao, mode, type, buffer, 0, static_cast<GLsizei>(m_commands.size()));
+    }
+};
+#endif
+
+} // namespace glwrap
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstring>
+
+#include "glwrap/include_gl.h"
+#include "glwrap/object.hpp"
+
+// Direct state access is compiled in when the GL headers declare it,
+// define `GLWRAP_NO_DSA` to always use the bind-to-edit path
+#if defined(GL_VERSION_4_5) && !defined(GLWRAP_NO_DSA)
+#define GLWRAP_DSA
+#endif
+
+namespace glwrap
+{
+
+/**
+ * @brief Runtime detection of optional GL features
+ *
+ * Results are cached per thread like the binding cache, and are detected
+ * again after `BindingCache::Invalidate()`. Overrides are kept.
+ */
+class Features
+{
+  public:
+    /**
+     * @brief Returns whether the current context is at least the given version
+     * @see glGetIntegerv
+     */
+    static bool HasVersion(GLint major, GLint minor)
+    {
+        GLint currentMajor = 0, currentMinor = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &currentMajor);
+        glGetIntegerv(GL_MINOR_VERSION, &currentMinor);
+        return currentMajor > major || (currentMajor == major && currentMinor >= minor);
+    }
+
+    /**
+     * @brief Returns whether the current context supports an extension
+     * @see glGetStringi
+     *
+     * @param name The name of the extension, e.g. `"GL_ARB_direct_state_access"`
+     */
+    static bool HasExtension(const char* name)
+    {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; i++)
+        {
+            const GLubyte* extension = glGetStringi(GL_EXTENSIONS, i);
+            if (extension && strcmp(reinterpret_cast<const char*>(extension), name) == 0) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns whether objects created from now on use direct state access
+     *
+     * This requires GL 4.5 or `GL_ARB_direct_state_access` at runtime and
+     * `GLWRAP_DSA` at compile time.
+     *
+     * @note Objects pick their path once when created, see e.g. `Buffer::IsDirect()`
+     */
+    static bool DirectStateAccess()
+    {
+#ifdef GLWRAP_DSA
+        int forced = DirectStateAccessOverride();
+        if (forced >= 0) return forced != 0;
+
+        BindingCache::Entry& dsa = DirectStateAccessEntry();
+        if (!dsa.IsValid())
+            dsa.Set(HasVersion(4, 5) || HasExtension("GL_ARB_direct_state_access"));
+        return dsa.value != 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Overrides the detected direct state access support for objects created from now on
+     *
+     * @note Existing objects keep the path they were created with
+     */
+    static void SetDirectStateAccess(bool enabled)
+    {
+        DirectStateAccessOverride() = enabled ? 1 : 0;
+    }
+
+    /// @brief Drops the override set with `SetDirectStateAccess`, using the detected support again
+    static void ResetDirectStateAccess()
+    {
+        DirectStateAccessOverride() = -1;
+    }
+
+    /**
+     * @brief Returns whether program objects can be edited without using them,
+     * e.g. with `glProgramUniform`
+     *
+     * This requires GL 4.1 or `GL_ARB_separate_shader_objects`.
+     */
+    static bool SeparateShaderObjects()
+    {
+#ifdef GL_VERSION_4_1
+        static thread_local BindingCache::Entry sso;
+        if (!sso.IsValid())
+            sso.Set(HasVersion(4, 1) || HasExtension("GL_ARB_separate_shader_objects"));
+        return sso.value != 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Returns whether compile and link status can be polled without
+     * blocking, e.g. with `Shader::IsComplete`
+     *
+     * This requires `GL_KHR_parallel_shader_compile` or `GL_ARB_parallel_shader_compile`.
+     */
+    static bool ParallelShaderCompile()
+    {
+        static thread_local BindingCache::Entry parallel;
+        if (!parallel.IsValid())
+            parallel.Set(HasExtension("GL_KHR_parallel_shader_compile") || HasExtension("GL_ARB_parallel_shader_compile"));
+        return parallel.value != 0;
+    }
+
+  private:
+    static BindingCache::Entry& DirectStateAccessEntry()
+    {
+        static thread_local BindingCache::Entry dsa;
+        return dsa;
+    }
+
+    /// @brief -1 without an override, otherwise whether direct state access is forced on
+    static int& DirectStateAccessOverride()
+    {
+        static thread_local int forced = -1;
+        return forced;
+    }
+};
+
+} // namespace glwrap
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "glwrap/mapped_file.hpp"
+
+namespace glwrap
+{
+
+/**
+ * @brief Loads files on worker threads and hands them to the GL thread
+ *
+ * Files are memory mapped and paged in on a worker, so the GL thread only
+ * receives contents that are ready to submit, e.g. to `Shader::Source` or to
+ * `TextureUploader` staging memory. Completed loads are passed to their
+ * callbacks by `Poll()` or `Finish()` on the thread calling those.
+ *
+ * `Load` may be called from any thread.
+ */
+class FileLoader
+{
+  public:
+    /// @brief A loaded file
+    struct Result
+    {
+        std::string path;
+        /// @brief The mapped file, check `IsOpen()` to see whether loading succeeded
+        std::unique_ptr<MappedFile> file;
+
+        inline explicit operator bool() const { return file && file->IsOpen(); }
+        inline std::string_view View() const { return file ? file->View() : std::string_view(); }
+    };
+
+    using Callback = std::function<void(Result& result)>;
+
+  protected:
+    struct Request
+    {
+        std::string path;
+        Callback callback;
+        std::unique_ptr<MappedFile> file;
+    };
+
+    std::vector<std::thread> m_workers;
+    std::deque<Request> m_queue = {};
+    std::vector<Request> m_done = {};
+    size_t m_pending = 0;
+    bool m_stopping = false;
+    std::mutex m_mutex;
+    std::condition_variable m_queued;
+    std::condition_variable m_finished;
+
+  public:
+    /**
+     * @brief Starts the worker threads
+     *
+     * @param threads The number of workers, more than one helps on drives with deep queues
+     */
+    explicit FileLoader(size_t threads = 1)
+    {
+        for (size_t i = 0; i < threads; i++) m_workers.emplace_back(&FileLoader::Work, this);
+    }
+
+    /// @brief Stops the workers, loads that have not started are dropped
+    ~FileLoader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_queued.notify_all();
+        for (std::thread& worker : m_workers) worker.join();
+    }
+
+    FileLoader(const FileLoader& other) = delete;
+    FileLoader& operator=(const FileLoader& other) = delete;
+    FileLoader(FileLoader&& other) = delete;
+
+    /**
+     * @brief Queues a file to be loaded
+     *
+     * @param path The path of the file
+     * @param callback Called with the loaded file by `Poll()` or `Finish()`
+     */
+    void Load(std::string path, Callback callback)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queue.push_back({std::move(path), std::move(callback), nullptr});
+            m_pending++;
+        }
+        m_queued.notify_one();
+    }
+
+    /// @brief Returns the number of loads whose callbacks have not been called
+    size_t Pending()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending;
+    }
+
+    /**
+     * @brief Calls the callbacks of all completed loads without waiting
+     *
+     * @return The number of callbacks called
+     */
+    size_t Poll()
+    {
+        std::vector<Request> done;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            done.swap(m_done);
+            m_pending -= done.size();
+        }
+
+        for (Request& request : done)
+        {
+            Result result = {std::move(request.path), std::move(request.file)};
+            request.callback(result);
+        }
+        return done.size();
+    }
+
+    /**
+     * @brief Waits for all queued loads and calls their callbacks
+     *
+     * @return The number of callbacks called
+     */
+    size_t Finish()
+    {
+        size_t called = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_finished.wait(lock, [&] { return m_pending == 0 || !m_done.empty(); });
+                if (m_pending == 0) return called;
+            }
+            called += Poll();
+        }
+    }
+
+  protected:
+    void Work()
+    {
+        while (true)
+        {
+            Request request;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_queued.wait(lock, [&] { return m_stopping || !m_queue.empty(); });
+                if (m_stopping) return;
+
+                request = std::move(m_queue.front());
+                m_queue.pop_front();
+            }
+
+            request.file = std::make_unique<MappedFile>(request.path.c_str());
+            request.file->Prefetch();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done.push_back(std::move(request));
+            }
+            m_finished.notify_all();
+        }
+    }
+};
+
+} // namespace glwrap
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace glwrap
+{
+
+/**
+ * @brief Reports changes to a set of files
+ *
+ * On Linux changes are read from inotify watches on the files' directories,
+ * which also catches editors that save by replacing the file. Elsewhere the
+ * files' modification times are compared on every `Poll()`.
+ */
+class FileWatcher
+{
+  protected:
+    std::unordered_set<std::string> m_files = {};
+#ifdef __linux__
+    int m_inotify = -1;
+    std::unordered_map<int, std::filesystem::path> m_directories = {};
+#else
+    std::unordered_map<std::string, std::filesystem::file_time_type> m_times = {};
+#endif
+
+  public:
+    FileWatcher()
+    {
+#ifdef __linux__
+        m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+    }
+
+    ~FileWatcher()
+    {
+#ifdef __linux__
+        if (m_inotify >= 0) close(m_inotify);
+#endif
+    }
+
+    FileWatcher(const FileWatcher& other) = delete;
+    FileWatcher& operator=(const FileWatcher& other) = delete;
+    FileWatcher(FileWatcher&& other) = delete;
+
+    /// @brief Normalizes a path the way watched and reported paths are compared
+    static std::filesystem::path Normalize(const std::filesystem::path& path)
+    {
+        std::error_code error;
+        std::filesystem::path absolute = std::filesystem::weakly_canonical(path, error);
+        return (error ? path : absolute).lexically_normal();
+    }
+
+    /// @brief Returns whether a file is watched
+    inline bool IsWatched(const std::filesystem::path& path) const
+    {
+        return m_files.count(Normalize(path).string()) > 0;
+    }
+
+    /**
+     * @brief Starts watching a file
+     * @see inotify_add_watch
+     */
+    void Watch(const std::filesystem::path& path)
+    {
+        std::filesystem::path file = Normalize(path);
+        if (!m_files.insert(file.string()).second) return;
+
+#ifdef __linux__
+        if (m_inotify < 0) return;
+
+        std::filesystem::path directory = file.parent_path();
+        int watch = inotify_add_watch(
+            m_inotify, directory.c_str(),
+            IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE
+        );
+        if (watch >= 0) m_directories[watch] = directory;
+#else
+        std::error_code error;
+        m_times[file.string()] = std::filesystem::last_write_time(file, error);
+#endif
+    }
+
+    /**
+     * @brief Collects the watched files that changed since the last call
+     * @see inotify
+     *
+     * @return The normalized paths of the changed files, without duplicates
+     */
+    std::vector<std::filesystem::path> Poll()
+    {
+        std::vector<std::filesystem::path> changed;
+        std::unordered_set<std::string> seen;
+
+#ifdef __linux__
+        if (m_inotify < 0) return changed;
+
+        alignas(inotify_event) char buffer[4096];
+        while (true)
+        {
+            ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+            if (length <= 0) break;
+
+            for (char* at = buffer; at < buffer + length;)
+            {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(at);
+                at += sizeof(inotify_event) + event->len;
+
+                auto directory = m_directories.find(event->wd);
+                if (directory == m_directories.end() || event->len == 0) continue;
+
+                std::string file = (directory->second / event->name).string();
+                if (m_files.count(file) && seen.insert(file).second) changed.push_back(file);
+            }
+        }
+#else
+        for (auto& [file, time] : m_times)
+        {
+            std::error_code error;
+            std::filesystem::file_time_type current = std::filesystem::last_write_time(file, error);
+            if (error || current == time) continue;
+
+            time = current;
+            changed.push_back(file);
+        }
+#endif
+
+        return changed;
+    }
+};
+
+} // namespace glwrap
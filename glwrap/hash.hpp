@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace glwrap
+{
+
+/// @brief The offset basis of the 64-bit FNV-1a hash
+constexpr uint64_t HASH_SEED = 0xcbf29ce484222325ull;
+
+/**
+ * @brief Hashes bytes with 64-bit FNV-1a, usable at compile time
+ *
+ * @param data The bytes to hash
+ * @param length The number of bytes
+ * @param seed The hash to continue from
+ */
+constexpr uint64_t Hash(const char* data, size_t length, uint64_t seed = HASH_SEED)
+{
+    uint64_t hash = seed;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+/// @brief Hashes a string with 64-bit FNV-1a, usable at compile time
+constexpr uint64_t Hash(std::string_view str, uint64_t seed = HASH_SEED)
+{
+    return Hash(str.data(), str.size(), seed);
+}
+
+/// @brief Mixes a value into a hash
+constexpr uint64_t HashCombine(uint64_t seed, uint64_t value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+} // namespace glwrap
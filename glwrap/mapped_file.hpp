@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace glwrap
+{
+
+/**
+ * @brief A read-only memory mapping of a file
+ *
+ * The file's contents are paged in by the OS on access instead of being
+ * copied through a stream.
+ *
+ * @note This header includes the platform headers, `windows.h` on Windows,
+ * so other headers only include it when they need the mapping themselves
+ */
+class MappedFile
+{
+  protected:
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_open = false;
+#ifdef _WIN32
+    HANDLE m_mapping = nullptr;
+#endif
+
+  public:
+    MappedFile() = default;
+    explicit MappedFile(const char* path) { Open(path); }
+    ~MappedFile() { Close(); }
+
+    /// @warning Deleted to prevent double unmapping, use `std::unique_ptr` instead
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile& operator=(const MappedFile& other) = delete;
+    MappedFile(MappedFile&& other) = delete;
+
+    /// @brief Returns whether a file is mapped, an empty file counts as mapped
+    inline bool IsOpen() const { return m_open; }
+    inline explicit operator bool() const { return m_open; }
+
+    /// @brief Returns the file's contents, not null-terminated
+    inline const char* Data() const { return m_data; }
+    inline size_t Size() const { return m_size; }
+    inline std::string_view View() const { return {m_data, m_size}; }
+
+    /**
+     * @brief Maps a file, replacing the current mapping
+     * @see mmap
+     * @see CreateFileMapping
+     *
+     * @return Whether the file was mapped
+     */
+    bool Open(const char* path)
+    {
+        Close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(
+            path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+        );
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        m_size = static_cast<size_t>(size.QuadPart);
+        if (m_size > 0)
+        {
+            m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (m_mapping) m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        }
+        CloseHandle(file);
+
+        if (m_size > 0 && !m_data)
+        {
+            Close();
+            return false;
+        }
+#else
+        int file = open(path, O_RDONLY);
+        if (file < 0) return false;
+
+        struct stat status;
+        if (fstat(file, &status) != 0)
+        {
+            close(file);
+            return false;
+        }
+
+        m_size = static_cast<size_t>(status.st_size);
+        if (m_size > 0)
+        {
+            void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, file, 0);
+            m_data = data == MAP_FAILED ? nullptr : static_cast<const char*>(data);
+        }
+        close(file);
+
+        if (m_size > 0 && !m_data)
+        {
+            m_size = 0;
+            return false;
+        }
+#endif
+
+        m_open = true;
+        return true;
+    }
+
+    /**
+     * @brief Reads every page of the mapping so later accesses do not fault
+     *
+     * @note Meant to be called on a loader thread, see `FileLoader`
+     */
+    void Prefetch() const
+    {
+        if (!m_data) return;
+
+#ifndef _WIN32
+        madvise(const_cast<char*>(m_data), m_size, MADV_WILLNEED);
+#endif
+        volatile char sink = 0;
+        for (size_t offset = 0; offset < m_size; offset += 4096) sink = sink + m_data[offset];
+    }
+
+    /**
+     * @brief Unmaps the file
+     * @see munmap
+     * @see UnmapViewOfFile
+     */
+    void Close()
+    {
+#ifdef _WIN32
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mapping) CloseHandle(m_mapping);
+        m_mapping = nullptr;
+#else
+        if (m_data) munmap(const_cast<char*>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_open = false;
+    }
+};
+
+} // namespace glwrap
@@ -1,31 +1,214 @@
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "glwrap/include_gl.h"
 
 namespace glwrap
 {
 
+/// @brief Counters kept by the binding cache
+struct BindingStats
+{
+    /// @brief The number of bind calls forwarded to GL
+    uint64_t issued = 0;
+    /// @brief The number of bind calls skipped because the object was already bound
+    uint64_t skipped = 0;
+    /// @brief The number of `glGetIntegerv` round trips needed to fill the cache
+    uint64_t queried = 0;
+};
+
+/**
+ * @brief A CPU-side shadow of the current context's bindings
+ *
+ * Bindings are context state and a context is current on one thread at a
+ * time, so the cache is `thread_local`.
+ *
+ * @warning Call `Invalidate()` after making another context current or after
+ * changing bindings without going through glwrap
+ */
+class BindingCache
+{
+  public:
+    /// @brief A cached value, valid while its generation is current
+    struct Entry
+    {
+        uint64_t generation = 0;
+        GLuint value = 0;
+
+        inline bool IsValid() const { return generation == Generation(); }
+        inline void Set(GLuint v)
+        {
+            generation = Generation();
+            value = v;
+        }
+        inline void Reset() { generation = 0; }
+    };
+
+    /// @brief Gets the counters of the calling thread
+    static BindingStats& Stats()
+    {
+        static thread_local BindingStats stats;
+        return stats;
+    }
+
+    /// @brief Resets the counters of the calling thread
+    static void ResetStats() { Stats() = BindingStats(); }
+
+    /// @brief Forgets all cached bindings, the next query goes to GL
+    static void Invalidate() { GenerationRef()++; }
+
+    /// @brief Gets the current generation, incremented by `Invalidate()`
+    static uint64_t Generation() { return GenerationRef(); }
+
+    /// @brief Gets the active texture unit, zero-based
+    static GLuint GetActiveUnit()
+    {
+        Entry& unit = ActiveUnit();
+        if (!unit.IsValid())
+        {
+            GLint active;
+            glGetIntegerv(GL_ACTIVE_TEXTURE, &active);
+            unit.Set(static_cast<GLuint>(active - GL_TEXTURE0));
+            Stats().queried++;
+        }
+        return unit.value;
+    }
+
+    /**
+     * @brief Makes a texture unit active
+     * @see glActiveTexture
+     *
+     * @param unit The zero-based texture unit
+     */
+    static void SetActiveUnit(GLuint unit)
+    {
+        Entry& active = ActiveUnit();
+        if (active.IsValid() && active.value == unit)
+        {
+            Stats().skipped++;
+            return;
+        }
+
+        glActiveTexture(GL_TEXTURE0 + unit);
+        active.Set(unit);
+        Stats().issued++;
+    }
+
+  private:
+    static uint64_t& GenerationRef()
+    {
+        static thread_local uint64_t generation = 1;
+        return generation;
+    }
+
+    static Entry& ActiveUnit()
+    {
+        static thread_local Entry unit;
+        return unit;
+    }
+};
+
+/// @brief Returns whether a binding is tracked per texture unit
+constexpr bool IsTextureBinding(GLenum binding)
+{
+    switch (binding)
+    {
+        case GL_TEXTURE_BINDING_1D:
+        case GL_TEXTURE_BINDING_2D:
+        case GL_TEXTURE_BINDING_3D:
+        case GL_TEXTURE_BINDING_1D_ARRAY:
+        case GL_TEXTURE_BINDING_2D_ARRAY:
+        case GL_TEXTURE_BINDING_CUBE_MAP:
+            return true;
+        default:
+            return false;
+    }
+}
+
 template <GLenum _binding>
 class Object
 {
   protected:
     GLuint m_handle = 0;
 
+    /// @brief Gets the cache entries of this binding, one per texture unit for textures
+    static std::vector<BindingCache::Entry>& Entries()
+    {
+        static thread_local std::vector<BindingCache::Entry> entries(1);
+        return entries;
+    }
+
+    /// @brief Gets the cache entry of this binding for the active texture unit
+    static BindingCache::Entry& Cached()
+    {
+        std::vector<BindingCache::Entry>& entries = Entries();
+        if (!IsTextureBinding(_binding)) return entries[0];
+
+        GLuint unit = BindingCache::GetActiveUnit();
+        if (unit >= entries.size()) entries.resize(unit + 1);
+        return entries[unit];
+    }
+
+    /**
+     * @brief Records that `handle` is being bound
+     *
+     * @param handle The handle to be bound
+     * @return Whether the bind call has to be issued
+     */
+    static bool Track(GLuint handle)
+    {
+        BindingCache::Entry& cached = Cached();
+        if (cached.IsValid() && cached.value == handle)
+        {
+            BindingCache::Stats().skipped++;
+            return false;
+        }
+
+        cached.Set(handle);
+        BindingCache::Stats().issued++;
+        return true;
+    }
+
+    /// @brief Drops `handle` from the cache, used when the object is deleted
+    static void Forget(GLuint handle)
+    {
+        for (BindingCache::Entry& entry : Entries())
+            if (entry.IsValid() && entry.value == handle) entry.Reset();
+    }
+
   public:
     static inline GLenum BINDING = _binding;
 
     inline GLuint Handle() const { return m_handle; }
 
-    /// @brief Gets the handle of the currently bound object
+    /**
+     * @brief Gets the handle of the currently bound object
+     *
+     * @note This function only queries GL if the binding is not cached
+     */
     static GLint GetBound()
     {
-        GLint handle;
-        glGetIntegerv(BINDING, &handle);
-        return handle;
+        BindingCache::Entry& cached = Cached();
+        if (!cached.IsValid())
+        {
+            GLint handle;
+            glGetIntegerv(BINDING, &handle);
+            cached.Set(static_cast<GLuint>(handle));
+            BindingCache::Stats().queried++;
+        }
+        return static_cast<GLint>(cached.value);
     }
 
     /// @brief Returns whether the object is currently bound
-    inline bool IsBound() const { return GetBound() == m_handle; }
+    inline bool IsBound() const { return GetBound() == static_cast<GLint>(m_handle); }
+
+    /// @brief Forgets the cached binding, e.g. after it was changed outside of glwrap
+    static void Invalidate()
+    {
+        for (BindingCache::Entry& entry : Entries()) entry.Reset();
+    }
 };
 
 } // namespace glwrap
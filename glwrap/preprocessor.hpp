@@ -0,0 +1,458 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+#include "glwrap/hash.hpp"
+#include "glwrap/mapped_file.hpp"
+#include "glwrap/shader.hpp"
+
+namespace glwrap
+{
+
+/// @brief Macros injected into a shader, as pairs of name and value
+using ShaderDefines = std::vector<std::pair<std::string, std::string>>;
+
+/// @brief The values a macro takes across shader variants
+struct DefineOption
+{
+    std::string name;
+    std::vector<std::string> values;
+};
+
+/**
+ * @brief Generates every combination of define values
+ *
+ * @param options The macros and the values each can take
+ * @return One set of defines per variant, e.g. 4 sets for two macros with two values each
+ */
+inline std::vector<ShaderDefines> Permutations(const std::vector<DefineOption>& options)
+{
+    std::vector<ShaderDefines> permutations(1);
+    for (const DefineOption& option : options)
+    {
+        std::vector<ShaderDefines> next;
+        next.reserve(permutations.size() * option.values.size());
+        for (const ShaderDefines& defines : permutations)
+        {
+            for (const std::string& value : option.values)
+            {
+                next.push_back(defines);
+                next.back().emplace_back(option.name, value);
+            }
+        }
+        permutations.swap(next);
+    }
+    return permutations;
+}
+
+/**
+ * @brief Computes the key of a shader variant
+ *
+ * @note The key does not depend on the order of the defines
+ */
+inline uint64_t VariantKey(std::string_view path, ShaderDefines defines)
+{
+    std::sort(defines.begin(), defines.end());
+
+    uint64_t key = Hash(path);
+    for (const auto& [name, value] : defines)
+        key = HashCombine(HashCombine(key, Hash(name)), Hash(value));
+    return key;
+}
+
+/// @brief A preprocessed shader source
+struct PreprocessedSource
+{
+    /// @brief The expanded source, ready for `Shader::Source`
+    std::string source;
+    /// @brief Every file the source was expanded from, the root file first
+    std::vector<std::filesystem::path> files;
+    /// @brief The reason preprocessing failed, empty on success
+    std::string error;
+
+    inline explicit operator bool() const { return error.empty(); }
+};
+
+/**
+ * @brief Expands `#include` directives and injects defines into shader sources
+ *
+ * Included files are resolved relative to the including file and then
+ * against the include paths. Each file is read and split at its includes
+ * once, and reused until it is invalidated. Files containing `#pragma once`
+ * are only expanded once per source.
+ *
+ * The expanded source carries `#line` directives whose source string number
+ * identifies the file, see `GetFile`.
+ */
+class ShaderPreprocessor
+{
+  protected:
+    struct Segment
+    {
+        /// @brief Text copied verbatim
+        std::string text;
+        /// @brief The file included after the text, empty if none
+        std::string include;
+        /// @brief The line after the include
+        int line;
+    };
+
+    struct File
+    {
+        std::filesystem::path path;
+        int index;
+        bool once;
+        std::vector<Segment> segments;
+    };
+
+    std::vector<std::filesystem::path> m_includePaths = {};
+    std::unordered_map<std::string, std::unique_ptr<File>> m_files = {};
+    /// @brief The paths by source string number, kept when their files are invalidated
+    std::vector<std::filesystem::path> m_indexed = {};
+    std::unordered_map<std::string, int> m_indices = {};
+
+  public:
+    ShaderPreprocessor() = default;
+
+    ShaderPreprocessor(const ShaderPreprocessor& other) = delete;
+    ShaderPreprocessor& operator=(const ShaderPreprocessor& other) = delete;
+    ShaderPreprocessor(ShaderPreprocessor&& other) = delete;
+
+    /// @brief Adds a directory to resolve `#include` directives against
+    void AddIncludePath(const std::filesystem::path& path)
+    {
+        m_includePaths.push_back(path);
+    }
+
+    /**
+     * @brief Gets the path of a file by its source string number
+     *
+     * @return The path, or an empty path if the number is unknown
+     */
+    std::filesystem::path GetFile(int index) const
+    {
+        if (index < 0 || index >= static_cast<int>(m_indexed.size())) return {};
+        return m_indexed[index];
+    }
+
+    /**
+     * @brief Preprocesses a shader file
+     *
+     * @param path The path of the root file
+     * @param defines The macros to define right after the `#version` directive
+     */
+    PreprocessedSource Process(const std::filesystem::path& path, const ShaderDefines& defines = {})
+    {
+        PreprocessedSource result;
+        File* file = Load(path);
+        if (!file)
+        {
+            result.error = "Failed to open " + path.string();
+            return result;
+        }
+
+        std::vector<File*> stack;
+        Expand(*file, result, stack);
+        if (!result) return result;
+
+        InjectDefines(result.source, defines);
+        return result;
+    }
+
+    /**
+     * @brief Drops a file from the cache so it is read again on next use
+     *
+     * @note Variants already compiled from the file are kept, see `ShaderVariants::Invalidate`
+     */
+    void Invalidate(const std::filesystem::path& path)
+    {
+        // the path is kept, a reloaded file gets the same source string number
+        m_files.erase(GetKey(path));
+    }
+
+    /// @brief Drops all files from the cache
+    void Clear()
+    {
+        m_files.clear();
+        m_indexed.clear();
+        m_indices.clear();
+    }
+
+    /// @brief Returns the normalized path a file is cached and listed in `PreprocessedSource::files` under
+    static std::string GetKey(const std::filesystem::path& path)
+    {
+        std::error_code error;
+        std::filesystem::path absolute = std::filesystem::weakly_canonical(path, error);
+        return (error ? path : absolute).lexically_normal().string();
+    }
+
+  protected:
+    File* Load(const std::filesystem::path& path)
+    {
+        std::string key = GetKey(path);
+        auto it = m_files.find(key);
+        if (it != m_files.end()) return it->second.get();
+
+        MappedFile source(path.string().c_str());
+        if (!source) return nullptr;
+
+        auto file = std::make_unique<File>();
+        file->path = key;
+        auto [index, inserted] = m_indices.emplace(key, static_cast<int>(m_indexed.size()));
+        if (inserted) m_indexed.push_back(key);
+        file->index = index->second;
+        file->once = false;
+        Parse(*file, source.View());
+
+        File* loaded = file.get();
+        m_files.emplace(std::move(key), std::move(file));
+        return loaded;
+    }
+
+    static void Parse(File& file, std::string_view source)
+    {
+        Segment segment = {{}, {}, 0};
+        int line = 0;
+        while (!source.empty())
+        {
+            size_t end = source.find('\n');
+            std::string_view text = source.substr(0, end == std::string_view::npos ? source.size() : end + 1);
+            source.remove_prefix(text.size());
+            line++;
+
+            std::string_view directive = text;
+            while (!directive.empty() && (directive.front() == ' ' || directive.front() == '\t'))
+                directive.remove_prefix(1);
+
+            if (directive.substr(0, 12) == "#pragma once")
+            {
+                file.once = true;
+                segment.text += '\n';
+                continue;
+            }
+
+            if (directive.substr(0, 8) == "#include")
+            {
+                size_t open = directive.find_first_of("\"<");
+                size_t close = open == std::string_view::npos
+                    ? open : directive.find(directive[open] == '"' ? '"' : '>', open + 1);
+                if (close != std::string_view::npos)
+                {
+                    segment.include = std::string(directive.substr(open + 1, close - open - 1));
+                    segment.line = line + 1;
+                    file.segments.push_back(std::move(segment));
+                    segment = {{}, {}, 0};
+                    continue;
+                }
+            }
+
+            segment.text += text;
+        }
+        file.segments.push_back(std::move(segment));
+    }
+
+    File* Resolve(const File& from, const std::string& include)
+    {
+        std::filesystem::path relative = from.path.parent_path() / include;
+        if (std::filesystem::exists(relative)) return Load(relative);
+
+        for (const std::filesystem::path& directory : m_includePaths)
+        {
+            std::filesystem::path path = directory / include;
+            if (std::filesystem::exists(path)) return Load(path);
+        }
+        return nullptr;
+    }
+
+    void Expand(File& file, PreprocessedSource& result, std::vector<File*>& stack)
+    {
+        if (std::find(stack.begin(), stack.end(), &file) != stack.end())
+        {
+            result.error = "Recursive include of " + file.path.string();
+            return;
+        }
+
+        bool included = std::find(result.files.begin(), result.files.end(), file.path) != result.files.end();
+        if (file.once && included) return;
+        if (!included) result.files.push_back(file.path);
+
+        stack.push_back(&file);
+        if (stack.size() > 1) AppendLine(result.source, 1, file.index);
+
+        for (const Segment& segment : file.segments)
+        {
+            result.source += segment.text;
+            if (segment.include.empty()) continue;
+
+            File* include = Resolve(file, segment.include);
+            if (!include)
+            {
+                result.error = "Failed to resolve #include \"" + segment.include + "\" in " + file.path.string();
+                return;
+            }
+
+            Expand(*include, result, stack);
+            if (!result) return;
+
+            AppendLine(result.source, segment.line, file.index);
+        }
+        stack.pop_back();
+    }
+
+    static void AppendLine(std::string& source, int line, int index)
+    {
+        if (!source.empty() && source.back() != '\n') source += '\n';
+        source += "#line " + std::to_string(line) + " " + std::to_string(index) + "\n";
+    }
+
+    static void InjectDefines(std::string& source, const ShaderDefines& defines)
+    {
+        if (defines.empty()) return;
+
+        // #version must stay the first directive
+        size_t position = 0, line = 1;
+        size_t version = source.find("#version");
+        if (version != std::string::npos)
+        {
+            size_t end = source.find('\n', version);
+            position = end == std::string::npos ? source.size() : end + 1;
+            line += std::count(source.begin(), source.begin() + position, '\n');
+        }
+
+        std::string injected;
+        if (position > 0 && source[position - 1] != '\n') injected += '\n';
+        for (const auto& [name, value] : defines)
+            injected += "#define " + name + " " + value + "\n";
+        injected += "#line " + std::to_string(line) + " 0\n";
+
+        source.insert(position, injected);
+    }
+};
+
+/// @brief Statistics of a variant cache
+struct VariantStats
+{
+    /// @brief The number of variants returned from the cache
+    uint64_t hits;
+    /// @brief The number of variants preprocessed and compiled
+    uint64_t misses;
+};
+
+/**
+ * @brief Compiles each unique shader variant once
+ *
+ * Variants are keyed on the root file and the set of defines, see
+ * `VariantKey`. Each variant remembers the files it was expanded from, so
+ * `Invalidate` evicts exactly the variants a changed file went into.
+ *
+ * @note Invalidating a file only through `ShaderPreprocessor::Invalidate`
+ * keeps returning the variants compiled from its previous contents
+ */
+template <GLenum _type>
+class ShaderVariants
+{
+  protected:
+    struct Variant
+    {
+        std::unique_ptr<Shader<_type>> shader;
+        std::vector<std::filesystem::path> files;
+    };
+
+    ShaderPreprocessor& m_preprocessor;
+    std::unordered_map<uint64_t, Variant> m_variants = {};
+    std::string m_error = {};
+    VariantStats m_stats = {};
+
+  public:
+    explicit ShaderVariants(ShaderPreprocessor& preprocessor)
+        : m_preprocessor(preprocessor) { }
+
+    ShaderVariants(const ShaderVariants& other) = delete;
+    ShaderVariants& operator=(const ShaderVariants& other) = delete;
+    ShaderVariants(ShaderVariants&& other) = delete;
+
+    inline size_t Size() const { return m_variants.size(); }
+    inline const VariantStats& Stats() const { return m_stats; }
+
+    /// @brief Returns why the last variant failed to preprocess
+    inline const std::string& GetError() const { return m_error; }
+
+    /**
+     * @brief Gets a compiled variant, preprocessing and compiling it on first use
+     *
+     * @param path The path of the root file
+     * @param defines The variant's defines
+     * @return The shader, check `GetCompileStatus()`, or `nullptr` if preprocessing failed
+     */
+    Shader<_type>* Get(const std::filesystem::path& path, const ShaderDefines& defines = {})
+    {
+        uint64_t key = VariantKey(path.string(), defines);
+        auto it = m_variants.find(key);
+        if (it != m_variants.end())
+        {
+            m_stats.hits++;
+            return it->second.shader.get();
+        }
+        m_stats.misses++;
+
+        PreprocessedSource source = m_preprocessor.Process(path, defines);
+        if (!source)
+        {
+            m_error = std::move(source.error);
+            return nullptr;
+        }
+
+        auto shader = std::make_unique<Shader<_type>>();
+        shader->Source(source.source.c_str());
+        shader->Compile();
+
+        Shader<_type>* compiled = shader.get();
+        m_variants.emplace(key, Variant{std::move(shader), std::move(source.files)});
+        return compiled;
+    }
+
+    /**
+     * @brief Drops a changed file from the preprocessor and evicts the variants including it
+     *
+     * @return The number of variants evicted
+     *
+     * @note Shaders of evicted variants are deleted, get them again through `Get`
+     */
+    size_t Invalidate(const std::filesystem::path& path)
+    {
+        m_preprocessor.Invalidate(path);
+
+        std::filesystem::path key = ShaderPreprocessor::GetKey(path);
+        size_t evicted = 0;
+        for (auto it = m_variants.begin(); it != m_variants.end();)
+        {
+            const std::vector<std::filesystem::path>& files = it->second.files;
+            if (std::find(files.begin(), files.end(), key) == files.end())
+            {
+                ++it;
+                continue;
+            }
+
+            it = m_variants.erase(it);
+            evicted++;
+        }
+        return evicted;
+    }
+
+    /// @brief Drops all variants
+    void Clear()
+    {
+        m_variants.clear();
+    }
+};
+
+} // namespace glwrap
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+
+#ifndef GL_VERSION_4_1
+#error "OpenGL 4.1 is required to use ProgramCache"
+#endif
+
+#include "glwrap/hash.hpp"
+#include "glwrap/shader.hpp"
+
+namespace glwrap
+{
+
+/// @brief Statistics of a program cache
+struct ProgramCacheStats
+{
+    /// @brief The number of programs loaded from a cached binary
+    uint64_t hits;
+    /// @brief The number of programs built from source
+    uint64_t misses;
+    /// @brief The number of cached binaries the driver rejected
+    uint64_t rejected;
+};
+
+/**
+ * @brief An on-disk cache of linked program binaries
+ *
+ * Programs are keyed on the types and sources of their shaders and the
+ * driver's vendor, renderer and version strings. A cached binary is loaded in
+ * place of compiling and linking, and programs are built from source when no
+ * binary is cached or the driver rejects it.
+ *
+ * @see glGetProgramBinary
+ * @see glProgramBinary
+ */
+class ProgramCache
+{
+  protected:
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t format;
+        uint64_t key;
+        uint64_t length;
+    };
+
+    static constexpr uint32_t MAGIC = 0x42575747; // "GWWB"
+
+    std::filesystem::path m_directory;
+    uint64_t m_driver;
+    ProgramCacheStats m_stats = {};
+
+  public:
+    /**
+     * @brief Creates a cache in a directory, creating the directory if needed
+     *
+     * @note Requires a current context to identify the driver
+     */
+    explicit ProgramCache(const std::filesystem::path& directory)
+        : m_directory(directory)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+
+        m_driver = HASH_SEED;
+        for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+        {
+            const GLubyte* string = glGetString(name);
+            if (string) m_driver = Hash(std::string_view(reinterpret_cast<const char*>(string)), m_driver);
+        }
+    }
+
+    ProgramCache(const ProgramCache& other) = delete;
+    ProgramCache& operator=(const ProgramCache& other) = delete;
+    ProgramCache(ProgramCache&& other) = delete;
+
+    inline const std::filesystem::path& Directory() const { return m_directory; }
+    inline const ProgramCacheStats& Stats() const { return m_stats; }
+    inline void ResetStats() { m_stats = {}; }
+
+    /**
+     * @brief Computes the key of a program built from shaders
+     *
+     * @param shaders The shaders, with their sources set
+     */
+    template <GLenum... _types>
+    uint64_t Key(const Shader<_types>&... shaders) const
+    {
+        uint64_t key = m_driver;
+        ((key = HashCombine(HashCombine(key, _types), Hash(shaders.GetSource()))), ...);
+        return key;
+    }
+
+    /**
+     * @brief Loads a cached binary into a program
+     * @see glProgramBinary
+     *
+     * @param program The program, e.g. a `Program` or `ShaderManager`
+     * @param key The key of the program
+     * @return Whether a binary was cached and accepted by the driver
+     */
+    template <typename P>
+    bool Load(P& program, uint64_t key)
+    {
+        std::ifstream file(GetPath(key), std::ios::binary);
+        if (!file) return false;
+
+        Header header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(Header))) return false;
+        if (header.magic != MAGIC || header.key != key) return false;
+
+        // a truncated or corrupt file is a miss, not an allocation failure
+        std::streampos start = file.tellg();
+        file.seekg(0, std::ios::end);
+        uint64_t remaining = static_cast<uint64_t>(file.tellg() - start);
+        file.seekg(start);
+        if (header.length > remaining || header.length > static_cast<uint64_t>(INT_MAX)) return false;
+
+        std::vector<char> binary(header.length);
+        if (!file.read(binary.data(), binary.size())) return false;
+
+        if (!program.Binary(header.format, binary.data(), static_cast<GLsizei>(binary.size())))
+        {
+            m_stats.rejected++;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Stores a linked program's binary in the cache
+     * @see glGetProgramBinary
+     *
+     * @param program The program, linked after `SetBinaryRetrievable(true)`
+     * @param key The key of the program
+     * @return Whether the binary was written
+     */
+    bool Save(const Program& program, uint64_t key)
+    {
+        GLenum format = 0;
+        std::vector<unsigned char> binary = program.GetBinary(format);
+        if (binary.empty()) return false;
+
+        // write to a temporary file so concurrent runs never read a partial binary
+        std::filesystem::path path = GetPath(key);
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file) return false;
+
+            Header header = {MAGIC, format, key, binary.size()};
+            file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+            if (!file) return false;
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        return !error;
+    }
+
+    /**
+     * @brief Links a program from a cached binary, or from source on a miss
+     *
+     * On a miss the shaders are compiled and attached, and the program is
+     * linked and stored in the cache.
+     *
+     * @param program The program, e.g. a `Program` or `ShaderManager`
+     * @param shaders The shaders, with their sources set but not compiled
+     * @return Whether the program linked successfully
+     */
+    template <typename P, GLenum... _types>
+    bool Link(P& program, Shader<_types>&... shaders)
+    {
+        uint64_t key = Key(shaders...);
+        if (Load(program, key))
+        {
+            m_stats.hits++;
+            return true;
+        }
+        m_stats.misses++;
+
+        if (!(shaders.Compile() && ...)) return false;
+        (program.Attach(shaders), ...);
+
+        program.SetBinaryRetrievable(true);
+        if (!program.Link()) return false;
+
+        Save(program, key);
+        return true;
+    }
+
+    /**
+     * @brief Removes a program's cached binary
+     *
+     * @return Whether a binary was removed
+     */
+    bool Remove(uint64_t key)
+    {
+        std::error_code error;
+        return std::filesystem::remove(GetPath(key), error);
+    }
+
+  protected:
+    std::filesystem::path GetPath(uint64_t key) const
+    {
+        char name[24];
+        snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+        return m_directory / name;
+    }
+};
+
+} // namespace glwrap
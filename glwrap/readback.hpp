@@ -0,0 +1,268 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+
+#ifndef GL_VERSION_3_2
+#error "OpenGL 3.2 is required to use AsyncReadback"
+#endif
+
+#include "glwrap/buffer.hpp"
+#include "glwrap/sync.hpp"
+#include "glwrap/texture.hpp"
+
+namespace glwrap
+{
+
+/**
+ * @brief A pool of pixel pack buffers for non-blocking readback
+ *
+ * Each readback copies into a `PixelPackBuffer` on the GPU and is fenced,
+ * the returned `Request` can then be polled or waited on and read once the
+ * copy has completed.
+ */
+class AsyncReadback
+{
+  protected:
+    struct Slot
+    {
+        PixelPackBuffer buffer;
+        Fence fence;
+        GLsizeiptr capacity = 0;
+        GLsizeiptr size = 0;
+        bool busy = false;
+        bool mapped = false;
+    };
+
+    std::vector<std::unique_ptr<Slot>> m_slots;
+
+  public:
+    /**
+     * @brief A handle to a pending readback
+     *
+     * @warning The request must not outlive the `AsyncReadback` it came from
+     */
+    class Request
+    {
+        friend class AsyncReadback;
+
+      protected:
+        Slot* m_slot = nullptr;
+
+        Request(Slot* slot) : m_slot(slot) {}
+
+      public:
+        Request() = default;
+        ~Request() { Release(); }
+
+        Request(const Request& other) = delete;
+        Request& operator=(const Request& other) = delete;
+
+        Request(Request&& other) : m_slot(other.m_slot) { other.m_slot = nullptr; }
+        Request& operator=(Request&& other)
+        {
+            if (this != &other)
+            {
+                Release();
+                m_slot = other.m_slot;
+                other.m_slot = nullptr;
+            }
+            return *this;
+        }
+
+        /// @brief Returns whether the request refers to a readback
+        inline bool IsValid() const { return m_slot != nullptr; }
+        inline explicit operator bool() const { return IsValid(); }
+
+        /// @brief Returns the size of the data in bytes
+        inline GLsizeiptr Size() const { return m_slot ? m_slot->size : 0; }
+
+        /**
+         * @brief Returns whether the data is available, without blocking
+         * @see glGetSynciv
+         */
+        bool IsReady() const { return m_slot && m_slot->fence.IsSignaled(); }
+
+        /**
+         * @brief Blocks until the data is available
+         * @see glClientWaitSync
+         */
+        void Wait() const
+        {
+            if (m_slot) m_slot->fence.Wait();
+        }
+
+        /**
+         * @brief Copies the data into caller-provided storage
+         * @see glGetBufferSubData
+         *
+         * @param data The storage to copy into, at least `Size()` bytes
+         *
+         * @note This function blocks until the data is available
+         */
+        void Get(void* data) const
+        {
+            Wait();
+            m_slot->buffer.Get(0, m_slot->size, data);
+        }
+
+        /**
+         * @brief Maps the data into the client's address space
+         * @see glMapBufferRange
+         *
+         * @return A pointer to the data, valid until `Unmap()` or `Release()`
+         *
+         * @note This function blocks until the data is available
+         */
+        const void* Map()
+        {
+            Wait();
+            m_slot->mapped = true;
+            return m_slot->buffer.MapRange(0, m_slot->size, GL_MAP_READ_BIT);
+        }
+
+        /// @brief Unmaps the data mapped by `Map()`
+        void Unmap()
+        {
+            if (!m_slot || !m_slot->mapped) return;
+            m_slot->buffer.Unmap();
+            m_slot->mapped = false;
+        }
+
+        /// @brief Returns the buffer to the pool, the request becomes invalid
+        void Release()
+        {
+            if (!m_slot) return;
+            Unmap();
+            m_slot->fence.Reset();
+            m_slot->busy = false;
+            m_slot = nullptr;
+        }
+    };
+
+    /**
+     * @param slots The maximum number of readbacks in flight
+     */
+    AsyncReadback(size_t slots = 3)
+    {
+        for (size_t i = 0; i < slots; i++) m_slots.push_back(std::make_unique<Slot>());
+    }
+
+    AsyncReadback(const AsyncReadback& other) = delete;
+    AsyncReadback& operator=(const AsyncReadback& other) = delete;
+    AsyncReadback(AsyncReadback&& other) = delete;
+
+    /// @brief Returns the number of readbacks in flight
+    size_t Pending() const
+    {
+        size_t pending = 0;
+        for (const auto& slot : m_slots) pending += slot->busy;
+        return pending;
+    }
+
+    /**
+     * @brief Reads pixels from the current read framebuffer
+     * @see glReadPixels
+     *
+     * @param x The x coordinate of the lower left pixel
+     * @param y The y coordinate of the lower left pixel
+     * @param width The width of the rectangle
+     * @param height The height of the rectangle
+     * @param format The format of the pixel data
+     * @param type The data type of the pixel data
+     * @return The request, invalid if all buffers are in flight
+     */
+    Request ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type)
+    {
+        Slot* slot = Acquire(GetImageSize(width, height, 1, format, type));
+        if (!slot) return {};
+
+        slot->buffer.Bind();
+        glReadPixels(x, y, width, height, format, type, nullptr);
+        slot->buffer.Unbind();
+
+        // flush so the fence signals while callers poll `IsReady()` without swapping
+        slot->fence.Insert();
+        glFlush();
+        return {slot};
+    }
+
+    /**
+     * @brief Reads a mipmap level of a texture
+     * @see glGetTexImage
+     *
+     * @param texture The texture to read
+     * @param level The level-of-detail number
+     * @param format The format of the pixel data
+     * @param type The data type of the pixel data
+     * @return The request, invalid if all buffers are in flight
+     *
+     * @note Cube maps are not supported, `glGetTexImage` only reads single faces
+     * @note This function binds the texture unless direct state access is used
+     */
+    template <GLenum _target, GLenum _binding>
+    Request ReadTexture(const Texture<_target, _binding>& texture, GLint level, GLenum format, GLenum type)
+    {
+        static_assert(_target != GL_TEXTURE_CUBE_MAP, "Cube maps are read per face, use ReadPixels on a framebuffer instead");
+
+        GLsizeiptr size = GetImageSize(
+            texture.GetLevelParameter(level, GL_TEXTURE_WIDTH),
+            texture.GetLevelParameter(level, GL_TEXTURE_HEIGHT),
+            texture.GetLevelParameter(level, GL_TEXTURE_DEPTH),
+            format, type
+        );
+
+        Slot* slot = Acquire(size);
+        if (!slot) return {};
+
+        slot->buffer.Bind();
+#ifdef GLWRAP_DSA
+        if (texture.IsDirect())
+            glGetTextureImage(texture.Handle(), level, format, type, static_cast<GLsizei>(size), nullptr);
+        else
+#endif
+        {
+            texture.Bind();
+            glGetTexImage(_target, level, format, type, nullptr);
+        }
+        slot->buffer.Unbind();
+
+        slot->fence.Insert();
+        glFlush();
+        return {slot};
+    }
+
+  protected:
+    /// @brief Gets the size of an image in a pixel pack buffer, honoring `GL_PACK_ALIGNMENT`
+    static GLsizeiptr GetImageSize(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type)
+    {
+        GLint alignment;
+        glGetIntegerv(GL_PACK_ALIGNMENT, &alignment);
+
+        GLsizeiptr row = static_cast<GLsizeiptr>(width) * GetPixelSize(format, type);
+        row = (row + alignment - 1) / alignment * alignment;
+        return row * height * depth;
+    }
+
+    Slot* Acquire(GLsizeiptr size)
+    {
+        for (auto& slot : m_slots)
+        {
+            if (slot->busy) continue;
+
+            if (slot->capacity < size)
+            {
+                slot->buffer.Store(size, GL_STREAM_READ, nullptr);
+                slot->capacity = size;
+            }
+            slot->size = size;
+            slot->busy = true;
+            return slot.get();
+        }
+        return nullptr;
+    }
+};
+
+} // namespace glwrap
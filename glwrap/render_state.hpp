@@ -0,0 +1,370 @@
+#pragma once
+
+#include <cstdint>
+#include <tuple>
+#include <unordered_map>
+
+#include "glwrap/include_gl.h"
+#include "glwrap/hash.hpp"
+#include "glwrap/object.hpp"
+
+namespace glwrap
+{
+
+/// @brief Blending of fragment colors, defaults to GL's initial state
+struct BlendState
+{
+    GLboolean enabled = GL_FALSE;
+    GLenum srcRGB = GL_ONE;
+    GLenum dstRGB = GL_ZERO;
+    GLenum srcAlpha = GL_ONE;
+    GLenum dstAlpha = GL_ZERO;
+    GLenum equationRGB = GL_FUNC_ADD;
+    GLenum equationAlpha = GL_FUNC_ADD;
+
+    inline auto Tie() const { return std::tie(enabled, srcRGB, dstRGB, srcAlpha, dstAlpha, equationRGB, equationAlpha); }
+};
+
+/// @brief The depth test and depth writes, defaults to GL's initial state
+struct DepthState
+{
+    GLboolean test = GL_FALSE;
+    GLboolean write = GL_TRUE;
+    GLenum func = GL_LESS;
+
+    inline auto Tie() const { return std::tie(test, write, func); }
+};
+
+/// @brief The stencil test of one face, defaults to GL's initial state
+struct StencilFace
+{
+    GLenum func = GL_ALWAYS;
+    GLint ref = 0;
+    GLuint readMask = ~0u;
+    GLuint writeMask = ~0u;
+    GLenum fail = GL_KEEP;
+    GLenum depthFail = GL_KEEP;
+    GLenum pass = GL_KEEP;
+
+    inline auto Tie() const { return std::tie(func, ref, readMask, writeMask, fail, depthFail, pass); }
+};
+
+/// @brief The stencil test, defaults to GL's initial state
+struct StencilState
+{
+    GLboolean enabled = GL_FALSE;
+    StencilFace front = {};
+    StencilFace back = {};
+};
+
+/// @brief Face culling, defaults to GL's initial state
+struct CullState
+{
+    GLboolean enabled = GL_FALSE;
+    GLenum face = GL_BACK;
+    GLenum frontFace = GL_CCW;
+
+    inline auto Tie() const { return std::tie(enabled, face, frontFace); }
+};
+
+/// @brief A window-space rectangle
+struct Rect
+{
+    GLint x = 0;
+    GLint y = 0;
+    GLsizei width = 0;
+    GLsizei height = 0;
+
+    inline auto Tie() const { return std::tie(x, y, width, height); }
+};
+
+/// @brief The scissor test, defaults to GL's initial state
+struct ScissorState
+{
+    GLboolean enabled = GL_FALSE;
+    Rect rect = {};
+};
+
+inline bool operator==(const BlendState& a, const BlendState& b) { return a.Tie() == b.Tie(); }
+inline bool operator==(const DepthState& a, const DepthState& b) { return a.Tie() == b.Tie(); }
+inline bool operator==(const StencilFace& a, const StencilFace& b) { return a.Tie() == b.Tie(); }
+inline bool operator==(const CullState& a, const CullState& b) { return a.Tie() == b.Tie(); }
+inline bool operator==(const Rect& a, const Rect& b) { return a.Tie() == b.Tie(); }
+
+inline bool operator==(const StencilState& a, const StencilState& b)
+{
+    return a.enabled == b.enabled && a.front == b.front && a.back == b.back;
+}
+
+inline bool operator==(const ScissorState& a, const ScissorState& b)
+{
+    return a.enabled == b.enabled && a.rect == b.rect;
+}
+
+/// @brief Counters kept by the render state tracker
+struct RenderStateStats
+{
+    /// @brief The number of states applied that differed from the current one
+    uint64_t applied = 0;
+    /// @brief The number of states skipped because they were already applied
+    uint64_t skipped = 0;
+    /// @brief The number of GL calls issued to apply the differences
+    uint64_t calls = 0;
+};
+
+/**
+ * @brief A description of the fixed-function pipeline state used by draws
+ *
+ * `Apply()` compares the state with the one last applied on the calling
+ * thread and only calls GL for the parts that differ. Functions of disabled
+ * tests, e.g. the blend function while blending is off, are left alone until
+ * the test is enabled again.
+ *
+ * A viewport with a zero width or height is left unchanged, so a state
+ * doesn't need to know the size of the framebuffer it is used with.
+ *
+ * @note The tracker is reset by `BindingCache::Invalidate()`, after which the
+ * next `Apply()` sets the whole state
+ * @warning Changing any of this state without going through `Apply()`
+ * requires a call to `Invalidate()`
+ */
+struct RenderState
+{
+    BlendState blend = {};
+    DepthState depth = {};
+    StencilState stencil = {};
+    CullState cull = {};
+    Rect viewport = {};
+    ScissorState scissor = {};
+
+    friend bool operator==(const RenderState& a, const RenderState& b)
+    {
+        return a.blend == b.blend && a.depth == b.depth && a.stencil == b.stencil
+            && a.cull == b.cull && a.viewport == b.viewport && a.scissor == b.scissor;
+    }
+
+    /// @brief Returns a hash of the state, equal for equal states
+    uint64_t Hash() const
+    {
+        uint64_t hash = HASH_SEED;
+        auto mix = [&hash](const auto&... values) { ((hash = HashCombine(hash, static_cast<uint64_t>(values))), ...); };
+        std::apply(mix, blend.Tie());
+        std::apply(mix, depth.Tie());
+        mix(stencil.enabled);
+        std::apply(mix, stencil.front.Tie());
+        std::apply(mix, stencil.back.Tie());
+        std::apply(mix, cull.Tie());
+        std::apply(mix, viewport.Tie());
+        mix(scissor.enabled);
+        std::apply(mix, scissor.rect.Tie());
+        return hash;
+    }
+
+    /// @brief Gets the counters of the calling thread
+    static RenderStateStats& Stats()
+    {
+        static thread_local RenderStateStats stats;
+        return stats;
+    }
+
+    /// @brief Resets the counters of the calling thread
+    static void ResetStats() { Stats() = RenderStateStats(); }
+
+    /// @brief Forgets the applied state, the next `Apply()` sets the whole state
+    static void Invalidate();
+
+    /**
+     * @brief Makes this the current state, calling GL only for the differences
+     * @see glEnable, glBlendFuncSeparate, glBlendEquationSeparate, glDepthFunc,
+     * glDepthMask, glStencilFuncSeparate, glStencilOpSeparate,
+     * glStencilMaskSeparate, glCullFace, glFrontFace, glViewport, glScissor
+     */
+    void Apply() const;
+
+  protected:
+    struct Tracked;
+
+    /// @brief Gets the state last applied on the calling thread
+    static Tracked& Applied();
+
+    static void SetCapability(GLenum capability, GLboolean enabled)
+    {
+        if (enabled) glEnable(capability);
+        else glDisable(capability);
+        Stats().calls++;
+    }
+
+    static void ApplyStencilFace(GLenum face, const StencilFace& state, StencilFace& current, bool all, bool enabled)
+    {
+        // the write mask also applies to clears so it is always set
+        if (all || state.writeMask != current.writeMask)
+        {
+            glStencilMaskSeparate(face, current.writeMask = state.writeMask);
+            Stats().calls++;
+        }
+        if (!all && !enabled) return;
+
+        if (all || std::tie(state.func, state.ref, state.readMask) != std::tie(current.func, current.ref, current.readMask))
+        {
+            glStencilFuncSeparate(face, state.func, state.ref, state.readMask);
+            current.func = state.func;
+            current.ref = state.ref;
+            current.readMask = state.readMask;
+            Stats().calls++;
+        }
+        if (all || std::tie(state.fail, state.depthFail, state.pass) != std::tie(current.fail, current.depthFail, current.pass))
+        {
+            glStencilOpSeparate(face, state.fail, state.depthFail, state.pass);
+            current.fail = state.fail;
+            current.depthFail = state.depthFail;
+            current.pass = state.pass;
+            Stats().calls++;
+        }
+    }
+};
+
+struct RenderState::Tracked
+{
+    uint64_t generation = 0;
+    RenderState state;
+};
+
+inline RenderState::Tracked& RenderState::Applied()
+{
+    static thread_local Tracked applied;
+    return applied;
+}
+
+inline void RenderState::Invalidate()
+{
+    Applied().generation = 0;
+}
+
+inline void RenderState::Apply() const
+{
+    Tracked& applied = Applied();
+    RenderState& current = applied.state;
+    bool all = applied.generation != BindingCache::Generation();
+    if (!all && *this == current)
+    {
+        Stats().skipped++;
+        return;
+    }
+    Stats().applied++;
+
+    auto differs = [all](const auto& a, const auto& b) { return all || !(a == b); };
+
+    // blending
+    if (differs(blend.enabled, current.blend.enabled))
+        SetCapability(GL_BLEND, current.blend.enabled = blend.enabled);
+    if ((all || blend.enabled) && differs(std::tie(blend.srcRGB, blend.dstRGB, blend.srcAlpha, blend.dstAlpha),
+        std::tie(current.blend.srcRGB, current.blend.dstRGB, current.blend.srcAlpha, current.blend.dstAlpha)))
+    {
+        glBlendFuncSeparate(blend.srcRGB, blend.dstRGB, blend.srcAlpha, blend.dstAlpha);
+        current.blend.srcRGB = blend.srcRGB;
+        current.blend.dstRGB = blend.dstRGB;
+        current.blend.srcAlpha = blend.srcAlpha;
+        current.blend.dstAlpha = blend.dstAlpha;
+        Stats().calls++;
+    }
+    if ((all || blend.enabled) && differs(std::tie(blend.equationRGB, blend.equationAlpha),
+        std::tie(current.blend.equationRGB, current.blend.equationAlpha)))
+    {
+        glBlendEquationSeparate(blend.equationRGB, blend.equationAlpha);
+        current.blend.equationRGB = blend.equationRGB;
+        current.blend.equationAlpha = blend.equationAlpha;
+        Stats().calls++;
+    }
+
+    // depth, the write mask also applies to clears so it is always set
+    if (differs(depth.test, current.depth.test))
+        SetCapability(GL_DEPTH_TEST, current.depth.test = depth.test);
+    if ((all || depth.test) && differs(depth.func, current.depth.func))
+    {
+        glDepthFunc(current.depth.func = depth.func);
+        Stats().calls++;
+    }
+    if (differs(depth.write, current.depth.write))
+    {
+        glDepthMask(current.depth.write = depth.write);
+        Stats().calls++;
+    }
+
+    // stencil
+    if (differs(stencil.enabled, current.stencil.enabled))
+        SetCapability(GL_STENCIL_TEST, current.stencil.enabled = stencil.enabled);
+    ApplyStencilFace(GL_FRONT, stencil.front, current.stencil.front, all, stencil.enabled);
+    ApplyStencilFace(GL_BACK, stencil.back, current.stencil.back, all, stencil.enabled);
+
+    // culling, the front face also affects `gl_FrontFacing` so it is always set
+    if (differs(cull.enabled, current.cull.enabled))
+        SetCapability(GL_CULL_FACE, current.cull.enabled = cull.enabled);
+    if ((all || cull.enabled) && differs(cull.face, current.cull.face))
+    {
+        glCullFace(current.cull.face = cull.face);
+        Stats().calls++;
+    }
+    if (differs(cull.frontFace, current.cull.frontFace))
+    {
+        glFrontFace(current.cull.frontFace = cull.frontFace);
+        Stats().calls++;
+    }
+
+    // viewport and scissor
+    if (viewport.width > 0 && viewport.height > 0 && differs(viewport, current.viewport))
+    {
+        glViewport(viewport.x, viewport.y, viewport.width, viewport.height);
+        current.viewport = viewport;
+        Stats().calls++;
+    }
+    if (differs(scissor.enabled, current.scissor.enabled))
+        SetCapability(GL_SCISSOR_TEST, current.scissor.enabled = scissor.enabled);
+    if ((all || scissor.enabled) && differs(scissor.rect, current.scissor.rect))
+    {
+        glScissor(scissor.rect.x, scissor.rect.y, scissor.rect.width, scissor.rect.height);
+        current.scissor.rect = scissor.rect;
+        Stats().calls++;
+    }
+
+    applied.generation = BindingCache::Generation();
+}
+
+/**
+ * @brief Interns render states, so each distinct state is stored once
+ *
+ * Returned states are immutable and stay valid until `Clear()`, so they can
+ * be shared between materials and compared by address.
+ */
+class RenderStateCache
+{
+  protected:
+    std::unordered_multimap<uint64_t, RenderState> m_states = {};
+
+  public:
+    RenderStateCache() = default;
+
+    RenderStateCache(const RenderStateCache& other) = delete;
+    RenderStateCache& operator=(const RenderStateCache& other) = delete;
+    RenderStateCache(RenderStateCache&& other) = delete;
+
+    inline size_t Size() const { return m_states.size(); }
+
+    /// @brief Gets the interned copy of a state, adding it if it is new
+    const RenderState& Get(const RenderState& state)
+    {
+        uint64_t hash = state.Hash();
+        auto [begin, end] = m_states.equal_range(hash);
+        for (auto it = begin; it != end; ++it)
+            if (it->second == state) return it->second;
+
+        return m_states.emplace(hash, state)->second;
+    }
+
+    /// @brief Removes all states, invalidating the returned references
+    void Clear()
+    {
+        m_states.clear();
+    }
+};
+
+} // namespace glwrap
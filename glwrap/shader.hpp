@@ -1,15 +1,35 @@
 #pragma once
 
-#include <istream>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "glwrap/include_gl.h"
+#include "glwrap/buffer.hpp"
+#include "glwrap/features.hpp"
+#include "glwrap/hash.hpp"
 #include "glwrap/object.hpp"
+#include "glwrap/uniform.hpp"
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
 
 namespace glwrap
 {
 
+// defined in `glwrap/mapped_file.hpp`, which is only needed for `Shader::SourceFile`
+// and kept out of this header as it includes the platform headers, e.g. `windows.h`
+class MappedFile;
+
 /**
  * @brief A single shader
  */
@@ -41,6 +61,31 @@ class Shader
         glShaderSource(m_handle, 1, &source, nullptr);
     }
 
+    /**
+     * @brief Sets the shader source from several strings, without concatenating them
+     * @see glShaderSource
+     *
+     * @param sources The strings, need not be null-terminated
+     * @param count The number of strings
+     */
+    void Source(const std::string_view* sources, size_t count)
+    {
+        std::vector<const char*> strings(count);
+        std::vector<GLint> lengths(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            strings[i] = sources[i].empty() ? "" : sources[i].data();
+            lengths[i] = static_cast<GLint>(sources[i].size());
+        }
+        glShaderSource(m_handle, static_cast<GLsizei>(count), strings.data(), lengths.data());
+    }
+
+    /// @brief Sets the shader source from several strings, e.g. `{header, body}`
+    void Source(std::initializer_list<std::string_view> sources)
+    {
+        Source(sources.begin(), sources.size());
+    }
+
     static Shader<_type> FromSource(const char* source)
     {
         Shader<_type> shader;
@@ -51,22 +96,27 @@ class Shader
     /**
      * @brief Sets the shader source from a file
      * @see glShaderSource
+     *
+     * @return Whether the file could be read, the source is set to empty otherwise
+     *
+     * @note The file is memory mapped rather than copied
+     * @note Include `glwrap/mapped_file.hpp` to use this function
      */
-    void SourceFile(const char* path)
+    template <typename F = MappedFile>
+    bool SourceFile(const char* path)
     {
-        using namespace std;
-
-        ifstream s(path);
-        string str((istreambuf_iterator<char>(s)), istreambuf_iterator<char>());
-        s.close();
-
-        Source(str.c_str());
+        F file(path);
+        std::string_view source = file.View();
+        Source(&source, 1);
+        return file.IsOpen();
     }
 
+    /// @note Include `glwrap/mapped_file.hpp` to use this function
+    template <typename F = MappedFile>
     static Shader<_type> FromSourceFile(const char* path)
     {
         Shader<_type> shader;
-        shader.SourceFile(path);
+        shader.template SourceFile<F>(path);
         return shader;
     }
 
@@ -82,6 +132,32 @@ class Shader
         return GetCompileStatus();
     }
 
+    /**
+     * @brief Starts compiling the shader without waiting for the result
+     * @see glCompileShader
+     *
+     * @note Query the result with `GetCompileStatus()` once `IsComplete()`
+     */
+    void Submit()
+    {
+        glCompileShader(m_handle);
+    }
+
+    /**
+     * @brief Returns whether compilation has finished
+     * @see glGetShaderiv
+     *
+     * @note Always true without `Features::ParallelShaderCompile()`
+     */
+    bool IsComplete() const
+    {
+        if (!Features::ParallelShaderCompile()) return true;
+
+        GLint complete;
+        glGetShaderiv(m_handle, GL_COMPLETION_STATUS_KHR, &complete);
+        return complete == GL_TRUE;
+    }
+
     /// @see glGetShaderiv
     bool GetCompileStatus() const
     {
@@ -90,6 +166,23 @@ class Shader
         return status == GL_TRUE;
     }
 
+    /**
+     * @brief Gets the shader's source
+     * @see glGetShaderSource
+     */
+    std::string GetSource() const
+    {
+        GLint length;
+        glGetShaderiv(m_handle, GL_SHADER_SOURCE_LENGTH, &length);
+        if (length == 0) return {};
+
+        std::string source(length, '\0');
+        glGetShaderSource(m_handle, length, nullptr, source.data());
+        source.resize(length - 1);
+
+        return source;
+    }
+
     /**
      * @brief Gets the shader's info log
      * @see glGetShaderInfoLog
@@ -109,6 +202,73 @@ class Shader
 using VertexShader = Shader<GL_VERTEX_SHADER>;
 using FragmentShader = Shader<GL_FRAGMENT_SHADER>;
 
+#ifdef GL_VERSION_3_2
+using GeometryShader = Shader<GL_GEOMETRY_SHADER>;
+#endif
+
+#ifdef GL_VERSION_4_0
+using TessControlShader = Shader<GL_TESS_CONTROL_SHADER>;
+using TessEvaluationShader = Shader<GL_TESS_EVALUATION_SHADER>;
+#endif
+
+#ifdef GL_VERSION_4_3
+using ComputeShader = Shader<GL_COMPUTE_SHADER>;
+#endif
+
+#ifdef GL_VERSION_3_1
+/**
+ * @brief The layout of a uniform block as queried from a program
+ */
+struct UniformBlock
+{
+    /// @brief A member of the block
+    struct Member
+    {
+        std::string name;
+        GLenum type;
+        GLint size;
+        GLint offset;
+        GLint arrayStride;
+        GLint matrixStride;
+    };
+
+    GLuint index = GL_INVALID_INDEX;
+    GLint size = 0;
+    GLint binding = 0;
+    std::vector<Member> members = {};
+
+    /**
+     * @brief Finds a member by name
+     *
+     * @param name The member's name, with or without the `Block.` prefix
+     * @return The member, or `nullptr` if it is not active
+     */
+    const Member* Find(std::string_view name) const
+    {
+        for (const Member& member : members)
+        {
+            std::string_view full = member.name;
+            if (full == name) return &member;
+
+            size_t dot = full.rfind('.');
+            if (dot != std::string_view::npos && full.substr(dot + 1) == name) return &member;
+        }
+        return nullptr;
+    }
+};
+
+/// @brief The layout of a member in a C++ struct mirroring a block
+struct BlockField
+{
+    const char* name;
+    size_t offset;
+    /// @brief The byte offset between array elements, 0 if the member is not an array
+    size_t arrayStride = 0;
+    /// @brief The byte offset between matrix columns, 0 if the member is not a matrix
+    size_t matrixStride = 0;
+};
+#endif
+
 /**
  * @brief A shader program
  */
@@ -116,14 +276,30 @@ class Program : public Object<GL_CURRENT_PROGRAM>
 {
   public:
     Program() { m_handle = glCreateProgram(); }
-    ~Program() { glDeleteProgram(m_handle); }
+    ~Program()
+    {
+        Forget(m_handle);
+        glDeleteProgram(m_handle);
+    }
 
     Program(const Program& other) = delete;
     Program& operator=(const Program& other) = delete;
     Program(Program&& other) = delete;
 
-    void Use() const { glUseProgram(m_handle); }
-    void Unuse() const { glUseProgram(0); }
+  protected:
+    /// @brief Takes ownership of an existing program
+    explicit Program(GLuint handle) { m_handle = handle; }
+
+  public:
+    /// @note Using is skipped if the program is already in use
+    void Use() const
+    {
+        if (Track(m_handle)) glUseProgram(m_handle);
+    }
+    void Unuse() const
+    {
+        if (Track(0)) glUseProgram(0);
+    }
 
     /**
      * @brief Attaches a shader to the program
@@ -150,11 +326,73 @@ class Program : public Object<GL_CURRENT_PROGRAM>
      * @see glLinkProgram
      *
      * @return Whether the program linked successfully
+     *
+     * @note The program is not validated, see `Validate()`
      */
     bool Link()
     {
         glLinkProgram(m_handle);
+        return GetLinkStatus();
+    }
+
+    /**
+     * @brief Validates the program against the current GL state
+     * @see glValidateProgram
+     *
+     * @return Whether the program can execute in the current state, the
+     * reason is written to the info log
+     *
+     * @note Only meaningful right before drawing, and may be slow
+     */
+    bool Validate() const
+    {
         glValidateProgram(m_handle);
+        return GetValidateStatus();
+    }
+
+    /// @see glGetProgramiv
+    bool GetValidateStatus() const
+    {
+        GLint status;
+        glGetProgramiv(m_handle, GL_VALIDATE_STATUS, &status);
+        return status == GL_TRUE;
+    }
+
+    /**
+     * @brief Starts linking the program without waiting for the result
+     * @see glLinkProgram
+     *
+     * @note Query the result with `FinishLink()` once `IsLinkComplete()`
+     */
+    void SubmitLink()
+    {
+        glLinkProgram(m_handle);
+    }
+
+    /**
+     * @brief Returns whether linking has finished
+     * @see glGetProgramiv
+     *
+     * @note Always true without `Features::ParallelShaderCompile()`
+     */
+    bool IsLinkComplete() const
+    {
+        if (!Features::ParallelShaderCompile()) return true;
+
+        GLint complete;
+        glGetProgramiv(m_handle, GL_COMPLETION_STATUS_KHR, &complete);
+        return complete == GL_TRUE;
+    }
+
+    /**
+     * @brief Finishes a link started with `SubmitLink()`
+     *
+     * @return Whether the program linked successfully
+     *
+     * @note This waits for the link to finish
+     */
+    bool FinishLink()
+    {
         return GetLinkStatus();
     }
 
@@ -181,6 +419,73 @@ class Program : public Object<GL_CURRENT_PROGRAM>
         return log;
     }
 
+#ifdef GL_VERSION_4_1
+    /**
+     * @brief Sets whether the program can be bound to individual stages of a `ProgramPipeline`
+     * @see glProgramParameteri
+     *
+     * @note Must be set before `Link()`
+     */
+    void SetSeparable(bool separable)
+    {
+        glProgramParameteri(m_handle, GL_PROGRAM_SEPARABLE, separable ? GL_TRUE : GL_FALSE);
+    }
+
+    /// @see glGetProgramiv
+    bool IsSeparable() const
+    {
+        GLint separable;
+        glGetProgramiv(m_handle, GL_PROGRAM_SEPARABLE, &separable);
+        return separable == GL_TRUE;
+    }
+
+    /**
+     * @brief Sets whether the program's binary may be retrieved after linking
+     * @see glProgramParameteri
+     *
+     * @note Must be set before `Link()` for `GetBinary` to succeed
+     */
+    void SetBinaryRetrievable(bool retrievable)
+    {
+        glProgramParameteri(m_handle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, retrievable ? GL_TRUE : GL_FALSE);
+    }
+
+    /**
+     * @brief Gets the linked program's binary
+     * @see glGetProgramBinary
+     *
+     * @param format Receives the driver-specific format of the binary
+     * @return The binary, empty if the program is not linked
+     */
+    std::vector<unsigned char> GetBinary(GLenum& format) const
+    {
+        GLint length = 0;
+        glGetProgramiv(m_handle, GL_PROGRAM_BINARY_LENGTH, &length);
+
+        std::vector<unsigned char> binary(length);
+        if (length == 0) return binary;
+
+        GLsizei written = 0;
+        glGetProgramBinary(m_handle, length, &written, &format, binary.data());
+        binary.resize(written);
+
+        return binary;
+    }
+
+    /**
+     * @brief Loads a binary retrieved with `GetBinary` in place of linking
+     * @see glProgramBinary
+     *
+     * @return Whether the binary was accepted, drivers reject binaries from
+     * other drivers or driver versions
+     */
+    bool Binary(GLenum format, const void* data, GLsizei length)
+    {
+        glProgramBinary(m_handle, format, data, length);
+        return GetLinkStatus();
+    }
+#endif
+
     /**
      * @brief Gets the number of active uniforms
      * @see glGetProgramiv
@@ -200,15 +505,225 @@ class Program : public Object<GL_CURRENT_PROGRAM>
     {
         return glGetUniformLocation(m_handle, name);
     }
+
+#ifdef GL_VERSION_4_3
+    /**
+     * @brief Gets the local work group size of a compute program
+     * @see glGetProgramiv
+     */
+    std::array<GLint, 3> GetWorkGroupSize() const
+    {
+        std::array<GLint, 3> size;
+        glGetProgramiv(m_handle, GL_COMPUTE_WORK_GROUP_SIZE, size.data());
+        return size;
+    }
+
+    /**
+     * @brief Launches work groups of a compute program
+     * @see glDispatchCompute
+     *
+     * @param x The number of work groups in the x dimension
+     * @param y The number of work groups in the y dimension
+     * @param z The number of work groups in the z dimension
+     *
+     * @note This function uses the program
+     * @note Use `Barrier` before reading the results
+     */
+    void Dispatch(GLuint x, GLuint y = 1, GLuint z = 1) const
+    {
+        Use();
+        glDispatchCompute(x, y, z);
+    }
+
+    /**
+     * @brief Launches work groups of a compute program, with counts read from a buffer
+     * @see glDispatchComputeIndirect
+     *
+     * @param buffer The buffer holding the x, y and z counts as `GLuint`s
+     * @param offset The offset of the counts in the buffer, a multiple of 4
+     *
+     * @note This function uses the program and binds the buffer
+     * @note Use `Barrier` with `GL_COMMAND_BARRIER_BIT` if the counts were written by a shader
+     */
+    void DispatchIndirect(const DispatchIndirectBuffer& buffer, GLintptr offset = 0) const
+    {
+        Use();
+        buffer.Bind();
+        glDispatchComputeIndirect(offset);
+    }
+#endif
+
+#ifdef GL_VERSION_3_1
+    /**
+     * @brief Gets the index of a uniform block
+     * @see glGetUniformBlockIndex
+     *
+     * @return The index, or `GL_INVALID_INDEX` if the block is not active
+     */
+    GLuint GetUniformBlockIndex(const char* name) const
+    {
+        return glGetUniformBlockIndex(m_handle, name);
+    }
+
+    /**
+     * @brief Assigns a binding point to a uniform block
+     * @see glUniformBlockBinding
+     *
+     * @param name The name of the block
+     * @param point The binding point, as passed to `UniformBuffer::BindBase`
+     * @return Whether the block is active
+     */
+    bool BindUniformBlock(const char* name, GLuint point)
+    {
+        GLuint index = GetUniformBlockIndex(name);
+        if (index == GL_INVALID_INDEX) return false;
+
+        glUniformBlockBinding(m_handle, index, point);
+        return true;
+    }
+
+    /**
+     * @brief Gets the layout of a uniform block
+     * @see glGetActiveUniformBlockiv
+     * @see glGetActiveUniformsiv
+     *
+     * @param name The name of the block
+     * @return The block, with an index of `GL_INVALID_INDEX` if it is not active
+     */
+    UniformBlock GetUniformBlock(const char* name) const
+    {
+        UniformBlock block;
+        block.index = GetUniformBlockIndex(name);
+        if (block.index == GL_INVALID_INDEX) return block;
+
+        GLint count;
+        glGetActiveUniformBlockiv(m_handle, block.index, GL_UNIFORM_BLOCK_DATA_SIZE, &block.size);
+        glGetActiveUniformBlockiv(m_handle, block.index, GL_UNIFORM_BLOCK_BINDING, &block.binding);
+        glGetActiveUniformBlockiv(m_handle, block.index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &count);
+
+        std::vector<GLint> indices(count);
+        glGetActiveUniformBlockiv(m_handle, block.index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, indices.data());
+
+        std::vector<GLuint> uniforms(indices.begin(), indices.end());
+        std::vector<GLint> types(count), sizes(count), offsets(count), arrayStrides(count), matrixStrides(count);
+        glGetActiveUniformsiv(m_handle, count, uniforms.data(), GL_UNIFORM_TYPE, types.data());
+        glGetActiveUniformsiv(m_handle, count, uniforms.data(), GL_UNIFORM_SIZE, sizes.data());
+        glGetActiveUniformsiv(m_handle, count, uniforms.data(), GL_UNIFORM_OFFSET, offsets.data());
+        glGetActiveUniformsiv(m_handle, count, uniforms.data(), GL_UNIFORM_ARRAY_STRIDE, arrayStrides.data());
+        glGetActiveUniformsiv(m_handle, count, uniforms.data(), GL_UNIFORM_MATRIX_STRIDE, matrixStrides.data());
+
+        GLint maxLength;
+        glGetProgramiv(m_handle, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+        std::string memberName(maxLength, '\0');
+
+        for (GLint i = 0; i < count; i++)
+        {
+            GLsizei length;
+            glGetActiveUniformName(m_handle, uniforms[i], maxLength, &length, memberName.data());
+            block.members.push_back({
+                std::string(memberName.data(), length),
+                static_cast<GLenum>(types[i]), sizes[i],
+                offsets[i], arrayStrides[i], matrixStrides[i],
+            });
+        }
+
+        return block;
+    }
+
+    /**
+     * @brief Checks a C++ struct against the queried layout of a uniform block
+     *
+     * @tparam T The struct mirroring the block
+     * @param name The name of the block
+     * @param fields The struct's members, e.g. `{"view", offsetof(Camera, view), 0, 4 * sizeof(GLfloat)}`
+     * @return Whether the block is active, fits in `T` and every field's offset and strides match
+     */
+    template <typename T>
+    bool CheckUniformBlock(const char* name, std::initializer_list<BlockField> fields) const
+    {
+        UniformBlock block = GetUniformBlock(name);
+        if (block.index == GL_INVALID_INDEX) return false;
+        if (sizeof(T) < static_cast<size_t>(block.size)) return false;
+
+        for (const BlockField& field : fields)
+        {
+            const UniformBlock::Member* member = block.Find(field.name);
+            if (!member || static_cast<size_t>(member->offset) != field.offset) return false;
+            if (static_cast<size_t>(member->arrayStride) != field.arrayStride) return false;
+            if (static_cast<size_t>(member->matrixStride) != field.matrixStride) return false;
+        }
+        return true;
+    }
+#endif
+
+#ifdef GL_VERSION_4_3
+    /**
+     * @brief Assigns a binding point to a shader storage block
+     * @see glShaderStorageBlockBinding
+     *
+     * @param name The name of the block
+     * @param point The binding point, as passed to `ShaderStorageBuffer::BindBase`
+     * @return Whether the block is active
+     */
+    bool BindShaderStorageBlock(const char* name, GLuint point)
+    {
+        GLuint index = glGetProgramResourceIndex(m_handle, GL_SHADER_STORAGE_BLOCK, name);
+        if (index == GL_INVALID_INDEX) return false;
+
+        glShaderStorageBlockBinding(m_handle, index, point);
+        return true;
+    }
+#endif
+};
+
+/// @brief Whether `ShaderManager` validates programs when linking
+enum class LinkMode
+{
+    /// @brief Only link
+    Release,
+    /// @brief Link and validate, the result is available through `GetValidateStatus()`
+    Debug,
+
+#ifdef NDEBUG
+    Default = Release,
+#else
+    Default = Debug,
+#endif
 };
 
 /**
  * @brief A shader program with uniform management
+ *
+ * Active uniforms are gathered when linking and looked up by name hash. A
+ * shadow copy of every uniform's value is kept, so setting a value that is
+ * already uploaded makes no GL call.
  */
 class ShaderManager : public Program
 {
+  public:
+    /// @brief An active uniform
+    struct Uniform
+    {
+        std::string name;
+        GLint location;
+        GLint size;
+        GLenum type;
+
+        /// @brief The offset of the uniform's value in the shadow storage
+        size_t offset;
+        /// @brief The index of the uniform's first element in the known flags
+        size_t element;
+    };
+
   protected:
-    std::vector<std::string> m_uniforms = {};
+    std::vector<Uniform> m_uniforms = {};
+    std::vector<unsigned char> m_values = {};
+    std::vector<unsigned char> m_known = {};
+    UniformTable m_table = {};
+    UniformStats m_stats = {};
+    LinkMode m_linkMode = LinkMode::Default;
+    /// @brief Unique across all managers, renewed whenever the uniforms are gathered again
+    uint64_t m_generation = NextGeneration();
 
   public:
     ShaderManager() = default;
@@ -223,15 +738,228 @@ class ShaderManager : public Program
      * @see glLinkProgram
      *
      * @return Whether the program linked successfully
+     *
+     * @note The program is also validated in `LinkMode::Debug`
      */
     bool Link()
     {
-        m_uniforms.clear();
-
+        ClearUniforms();
         if (!Program::Link()) return false;
 
-        // gather uniforms
+        GatherUniforms();
+        if (m_linkMode == LinkMode::Debug) Validate();
+        return true;
+    }
+
+    /**
+     * @brief Finishes a link started with `SubmitLink()`, gathering uniforms
+     *
+     * @return Whether the program linked successfully
+     *
+     * @note This waits for the link to finish
+     */
+    bool FinishLink()
+    {
+        ClearUniforms();
+        if (!Program::FinishLink()) return false;
+
+        GatherUniforms();
+        if (m_linkMode == LinkMode::Debug) Validate();
+        return true;
+    }
+
+    /// @brief Sets whether linking also validates, defaults to `Debug` unless `NDEBUG` is defined
+    inline void SetLinkMode(LinkMode mode) { m_linkMode = mode; }
+    inline LinkMode GetLinkMode() const { return m_linkMode; }
+
+#ifdef GL_VERSION_4_1
+    /**
+     * @brief Loads a program binary in place of linking
+     * @see glProgramBinary
+     *
+     * @return Whether the binary was accepted
+     */
+    bool Binary(GLenum format, const void* data, GLsizei length)
+    {
+        ClearUniforms();
+        if (!Program::Binary(format, data, length)) return false;
+
+        GatherUniforms();
+        return true;
+    }
+#endif
+
+    /**
+     * @brief Gets the number of active uniforms
+     * @see glGetProgramiv
+     */
+    GLint GetUniformCount() const
+    {
+        return static_cast<GLint>(m_uniforms.size());
+    }
+
+    /**
+     * @brief Gets an active uniform by name hash
+     *
+     * @param hash The hash of the uniform's name, see `Hash`
+     * @return The uniform, or `nullptr` if it is not active
+     */
+    const Uniform* GetUniform(uint64_t hash) const
+    {
+        int32_t index = m_table.Find(hash);
+        return index < 0 ? nullptr : &m_uniforms[index];
+    }
+
+    /// @brief Gets an active uniform by name, or `nullptr` if it is not active
+    inline const Uniform* GetUniform(std::string_view name) const { return GetUniform(Hash(name)); }
+
+    /**
+     * @brief Gets the location of a uniform variable
+     * @see glGetUniformLocation
+     *
+     * @note This function does not query GL, locations are gathered when linking
+     */
+    GLint GetUniformLocation(const char* name) const
+    {
+        const Uniform* uniform = GetUniform(name);
+        return uniform ? uniform->location : -1;
+    }
+
+    /**
+     * @brief Sets a uniform, skipping the upload if the value is unchanged
+     * @see glUniform
+     *
+     * The GL function is chosen from the uniform's type, so `T` may be any
+     * trivially copyable type with the same layout, e.g. `GLfloat[16]` or a
+     * math library's matrix for a `mat4`. Arrays of `T` set leading elements.
+     *
+     * @param hash The hash of the uniform's name, see `Hash`
+     * @param value The value to set
+     * @return Whether the uniform is active and matches `T`, see `IsUniformCompatible`
+     *
+     * @note This function uses the program unless `glProgramUniform` is available
+     */
+    template <typename T>
+    bool Set(uint64_t hash, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+        int32_t index = m_table.Find(hash);
+        if (index < 0) return false;
+
+        Uniform& uniform = m_uniforms[index];
+        if (!IsUniformCompatible<T>(uniform.type, uniform.size)) return false;
+        return Upload(uniform, 0, &value, sizeof(T));
+    }
+
+    /// @see Set(uint64_t, const T&)
+    template <typename T>
+    inline bool Set(std::string_view name, const T& value) { return Set(Hash(name), value); }
+
+    /// @see Set(uint64_t, const T&)
+    template <typename T>
+    inline bool Set(const char* name, const T& value) { return Set(Hash(name), value); }
+
+    /**
+     * @brief Resolves a uniform to a handle for fast, checked access
+     *
+     * @tparam T The C++ type the uniform will be set with
+     * @param hash The hash of the uniform's name, e.g. `"u_mvp"_uniform`
+     * @return The handle, invalid if the uniform is not active or does not match `T`
+     */
+    template <typename T>
+    UniformHandle<T> Resolve(uint64_t hash) const
+    {
+        int32_t index = m_table.Find(hash);
+        if (index < 0) return {};
+
+        const Uniform& uniform = m_uniforms[index];
+        if (!IsUniformCompatible<T>(uniform.type, uniform.size)) return {};
+        return UniformHandle<T>(index, m_generation);
+    }
+
+    /// @see Resolve(uint64_t)
+    template <typename T>
+    inline UniformHandle<T> Resolve(std::string_view name) const { return Resolve<T>(Hash(name)); }
+
+    /**
+     * @brief Sets a resolved uniform, skipping the upload if the value is unchanged
+     * @see glUniform
+     *
+     * @param handle The handle returned by `Resolve`
+     * @param value The value to set
+     * @return Whether the handle is valid and was resolved after the last link
+     *
+     * @note This function uses the program unless `glProgramUniform` is available
+     */
+    template <typename T>
+    bool Set(UniformHandle<T> handle, const T& value)
+    {
+        if (!handle || handle.Generation() != m_generation) return false;
+        if (static_cast<size_t>(handle.Index()) >= m_uniforms.size()) return false;
+        return Upload(m_uniforms[handle.Index()], 0, &value, sizeof(T));
+    }
+
+    /**
+     * @brief Sets elements of an array uniform, skipping the upload if they are unchanged
+     * @see glUniform
+     *
+     * @param hash The hash of the uniform's name, see `Hash`
+     * @param first The index of the first element to set
+     * @param value The value of one or more consecutive elements
+     * @return Whether the uniform is active and the elements match `T`
+     *
+     * @note This function uses the program unless `glProgramUniform` is available
+     */
+    template <typename T>
+    bool SetElements(uint64_t hash, GLint first, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+        int32_t index = m_table.Find(hash);
+        if (index < 0) return false;
+
+        Uniform& uniform = m_uniforms[index];
+        if (first < 0 || first >= uniform.size) return false;
+        if (!IsUniformCompatible<T>(uniform.type, uniform.size - first)) return false;
+        return Upload(uniform, first, &value, sizeof(T));
+    }
+
+    /// @see SetElements(uint64_t, GLint, const T&)
+    template <typename T>
+    inline bool SetElements(std::string_view name, GLint first, const T& value) { return SetElements(Hash(name), first, value); }
 
+    /// @brief Gets the counters of the uniform shadow
+    inline const UniformStats& GetUniformStats() const { return m_stats; }
+
+    /// @brief Resets the counters of the uniform shadow
+    inline void ResetUniformStats() { m_stats = UniformStats(); }
+
+    /// @brief Forgets all shadowed values, e.g. after uniforms were set outside of the manager
+    void InvalidateUniforms()
+    {
+        std::fill(m_known.begin(), m_known.end(), false);
+    }
+
+  protected:
+    /// @brief Returns a generation no manager has used yet, so handles can't pass between managers
+    static uint64_t NextGeneration()
+    {
+        static std::atomic<uint64_t> generation = 1;
+        return generation++;
+    }
+
+    void ClearUniforms()
+    {
+        m_generation = NextGeneration();
+        m_uniforms.clear();
+        m_values.clear();
+        m_known.clear();
+        m_table.Clear();
+    }
+
+    void GatherUniforms()
+    {
         GLint count, maxLength;
         glGetProgramiv(m_handle, GL_ACTIVE_UNIFORMS, &count);
         glGetProgramiv(m_handle, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
@@ -239,38 +967,291 @@ class ShaderManager : public Program
         int length;
         GLint size;
         GLenum type;
-        GLchar* name = new GLchar[maxLength];
+        std::string name(maxLength, '\0');
+        size_t offset = 0, element = 0;
         for (int i = 0; i < count; i++)
         {
             glGetActiveUniform(
                 m_handle, i, maxLength, &length,
-                &size, &type, name
+                &size, &type, name.data()
             );
-            m_uniforms.push_back(std::string(name, length));
+
+            // uniforms in blocks have no location
+            GLint location = glGetUniformLocation(m_handle, name.c_str());
+            if (location < 0) continue;
+
+            Uniform uniform = {std::string(name.data(), length), location, size, type, offset, element};
+            offset += static_cast<size_t>(size) * GetUniformTypeSize(type);
+            element += size;
+
+            // arrays are reported as `name[0]`, make them available as `name` too
+            int32_t index = static_cast<int32_t>(m_uniforms.size());
+            std::string_view key = uniform.name;
+            m_table.Insert(Hash(key), index);
+            if (key.size() > 3 && key.substr(key.size() - 3) == "[0]")
+                m_table.Insert(Hash(key.substr(0, key.size() - 3)), index);
+
+            m_uniforms.push_back(std::move(uniform));
+        }
+        m_values.resize(offset);
+        m_known.resize(element, false);
+    }
+
+    bool Upload(Uniform& uniform, GLint first, const void* data, size_t size)
+    {
+        GLsizei elementSize = GetUniformTypeSize(uniform.type);
+        if (size % elementSize != 0) return false;
+
+        GLint count = static_cast<GLint>(size / elementSize);
+        if (count == 0 || first + count > uniform.size) return false;
+
+        unsigned char* shadow = m_values.data() + uniform.offset + first * elementSize;
+        unsigned char* known = m_known.data() + uniform.element + first;
+
+        bool allKnown = true;
+        for (GLint i = 0; i < count && allKnown; i++) allKnown = known[i];
+        if (allKnown && memcmp(shadow, data, size) == 0)
+        {
+            m_stats.skipped++;
+            return true;
         }
 
+        memcpy(shadow, data, size);
+        memset(known, true, count);
+        m_stats.uploaded++;
+
+        // elements of arrays of basic types have consecutive locations
+        GLint location = uniform.location + first;
+
+#ifdef GL_VERSION_4_1
+        if (Features::SeparateShaderObjects())
+        {
+            UploadProgramUniform(m_handle, location, uniform.type, count, data);
+            return true;
+        }
+#endif
+        Use();
+        UploadUniform(location, uniform.type, count, data);
         return true;
     }
+};
+
+#ifdef GL_VERSION_4_1
+/// @brief Gets the `glUseProgramStages` bit of a shader type, or 0 if unknown
+constexpr GLbitfield GetShaderStageBit(GLenum type)
+{
+    switch (type)
+    {
+        case GL_VERTEX_SHADER:          return GL_VERTEX_SHADER_BIT;
+        case GL_TESS_CONTROL_SHADER:    return GL_TESS_CONTROL_SHADER_BIT;
+        case GL_TESS_EVALUATION_SHADER: return GL_TESS_EVALUATION_SHADER_BIT;
+        case GL_GEOMETRY_SHADER:        return GL_GEOMETRY_SHADER_BIT;
+        case GL_FRAGMENT_SHADER:        return GL_FRAGMENT_SHADER_BIT;
+#ifdef GL_VERSION_4_3
+        case GL_COMPUTE_SHADER:         return GL_COMPUTE_SHADER_BIT;
+#endif
+        default:                        return 0;
+    }
+}
+
+/**
+ * @brief A separable program with a single stage
+ *
+ * Stage programs are combined at bind time by a `ProgramPipeline`, so N
+ * vertex and M fragment stages need N + M links instead of N * M.
+ */
+template <GLenum _type>
+class StageProgram : public Program
+{
+  public:
+    static constexpr GLenum TYPE = _type;
+    static constexpr GLbitfield STAGE = GetShaderStageBit(_type);
 
     /**
-     * @brief Gets the number of active uniforms
-     * @see glGetProgramiv
+     * @brief Compiles and links the stage in one step
+     * @see glCreateShaderProgramv
+     *
+     * @note Check `GetLinkStatus()` and `GetInfoLog()` for errors
      */
-    GLint GetUniformCount() const
+    explicit StageProgram(const char* source)
+        : Program(glCreateShaderProgramv(TYPE, 1, &source)) { }
+};
+
+using VertexStageProgram = StageProgram<GL_VERTEX_SHADER>;
+using FragmentStageProgram = StageProgram<GL_FRAGMENT_SHADER>;
+using GeometryStageProgram = StageProgram<GL_GEOMETRY_SHADER>;
+using TessControlStageProgram = StageProgram<GL_TESS_CONTROL_SHADER>;
+using TessEvaluationStageProgram = StageProgram<GL_TESS_EVALUATION_SHADER>;
+#ifdef GL_VERSION_4_3
+using ComputeStageProgram = StageProgram<GL_COMPUTE_SHADER>;
+#endif
+
+/**
+ * @brief A program pipeline object, combining separable programs per stage
+ *
+ * @note A program in use with `Program::Use()` takes precedence over the
+ * bound pipeline, call `Program::Unuse()` first
+ */
+class ProgramPipeline : public Object<GL_PROGRAM_PIPELINE_BINDING>
+{
+  public:
+    ProgramPipeline()
     {
-        return static_cast<GLint>(m_uniforms.size());
+#ifdef GLWRAP_DSA
+        if (Features::DirectStateAccess())
+        {
+            glCreateProgramPipelines(1, &m_handle);
+            return;
+        }
+#endif
+        glGenProgramPipelines(1, &m_handle);
+    }
+    ~ProgramPipeline()
+    {
+        Forget(m_handle);
+        glDeleteProgramPipelines(1, &m_handle);
+    }
+
+    /// @warning Deleted to prevent double deletion, use `std::unique_ptr` instead
+    ProgramPipeline(const ProgramPipeline& other) = delete;
+    ProgramPipeline& operator=(const ProgramPipeline& other) = delete;
+    ProgramPipeline(ProgramPipeline&& other) = delete;
+
+    /// @note Binding is skipped if the pipeline is already bound
+    void Bind() const
+    {
+        if (Track(m_handle)) glBindProgramPipeline(m_handle);
+    }
+    void Unbind() const
+    {
+        if (Track(0)) glBindProgramPipeline(0);
     }
 
     /**
-     * @brief Gets the location of a uniform variable
-     * @see glGetUniformLocation
+     * @brief Uses stages of a separable program in the pipeline
+     * @see glUseProgramStages
+     *
+     * @param stages The stages to use the program for, e.g. `GL_VERTEX_SHADER_BIT`
+     * @param program The program, linked after `SetSeparable(true)`
      */
-    GLint GetUniformLocation(const char* name) const
+    void UseStages(GLbitfield stages, const Program& program)
+    {
+        glUseProgramStages(m_handle, stages, program.Handle());
+    }
+
+    /// @brief Uses a stage program for its stage
+    template <GLenum _type>
+    void UseStage(const StageProgram<_type>& program)
+    {
+        UseStages(StageProgram<_type>::STAGE, program);
+    }
+
+    /**
+     * @brief Clears stages of the pipeline
+     * @see glUseProgramStages
+     */
+    void ClearStages(GLbitfield stages)
+    {
+        glUseProgramStages(m_handle, stages, 0);
+    }
+
+    /**
+     * @brief Validates the pipeline against the current GL state
+     * @see glValidateProgramPipeline
+     */
+    bool Validate() const
+    {
+        glValidateProgramPipeline(m_handle);
+
+        GLint status;
+        glGetProgramPipelineiv(m_handle, GL_VALIDATE_STATUS, &status);
+        return status == GL_TRUE;
+    }
+
+    /**
+     * @brief Gets the pipeline's info log
+     * @see glGetProgramPipelineInfoLog
+     */
+    std::string GetInfoLog() const
+    {
+        GLint length;
+        glGetProgramPipelineiv(m_handle, GL_INFO_LOG_LENGTH, &length);
+
+        std::string log(length, '\0');
+        glGetProgramPipelineInfoLog(m_handle, length, nullptr, log.data());
+
+        return log;
+    }
+};
+
+/**
+ * @brief Creates each combination of stage programs into a pipeline once
+ *
+ * Pipelines are keyed on the stage programs' types and handles.
+ */
+class ProgramPipelineCache
+{
+  protected:
+    struct Entry
+    {
+        std::vector<GLenum> types;
+        std::vector<GLuint> programs;
+        std::unique_ptr<ProgramPipeline> pipeline;
+    };
+
+    // chained, as different stage programs may have the same key
+    std::unordered_multimap<uint64_t, Entry> m_pipelines = {};
+
+  public:
+    ProgramPipelineCache() = default;
+
+    ProgramPipelineCache(const ProgramPipelineCache& other) = delete;
+    ProgramPipelineCache& operator=(const ProgramPipelineCache& other) = delete;
+    ProgramPipelineCache(ProgramPipelineCache&& other) = delete;
+
+    inline size_t Size() const { return m_pipelines.size(); }
+
+    /**
+     * @brief Gets the pipeline combining stage programs, creating it on first use
+     *
+     * @param programs The stage programs, one per stage
+     */
+    template <GLenum... _types>
+    ProgramPipeline& Get(const StageProgram<_types>&... programs)
+    {
+        uint64_t key = HASH_SEED;
+        ((key = HashCombine(HashCombine(key, _types), programs.Handle())), ...);
+
+        std::vector<GLenum> types = {_types...};
+        std::vector<GLuint> handles = {programs.Handle()...};
+        auto [begin, end] = m_pipelines.equal_range(key);
+        for (auto it = begin; it != end; ++it)
+            if (it->second.types == types && it->second.programs == handles) return *it->second.pipeline;
+
+        Entry& entry = m_pipelines.emplace(key, Entry{std::move(types), std::move(handles), std::make_unique<ProgramPipeline>()})->second;
+        (entry.pipeline->UseStage(programs), ...);
+        return *entry.pipeline;
+    }
+
+    /// @brief Drops the pipelines using a program, call this before deleting the program
+    void Remove(const Program& program)
+    {
+        for (auto it = m_pipelines.begin(); it != m_pipelines.end();)
+        {
+            const std::vector<GLuint>& programs = it->second.programs;
+            if (std::find(programs.begin(), programs.end(), program.Handle()) != programs.end())
+                it = m_pipelines.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    /// @brief Drops all pipelines
+    void Clear()
     {
-        auto it = std::find(m_uniforms.begin(), m_uniforms.end(), name);
-        if (it == m_uniforms.end()) return -1;
-        return static_cast<GLint>(it - m_uniforms.begin());
+        m_pipelines.clear();
     }
 };
+#endif
 
 } // namespace glwrap
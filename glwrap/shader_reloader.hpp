@@ -0,0 +1,234 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+#include "glwrap/file_watcher.hpp"
+#include "glwrap/preprocessor.hpp"
+#include "glwrap/shader.hpp"
+
+namespace glwrap
+{
+
+/// @brief A shader stage of a reloadable program, see `MakeShaderStage`
+struct ShaderStage
+{
+    GLenum type;
+    std::filesystem::path path;
+    ShaderDefines defines;
+
+    /// @brief Creates and compiles a shader of the stage's type
+    std::shared_ptr<void> (*compile)(const std::string& source, std::string* log);
+    /// @brief Attaches a shader created by `compile` to a program
+    void (*attach)(Program& program, const void* shader);
+};
+
+/**
+ * @brief Describes a shader stage of a reloadable program
+ *
+ * @param path The path of the stage's root file
+ * @param defines The stage's defines
+ */
+template <GLenum _type>
+ShaderStage MakeShaderStage(const std::filesystem::path& path, const ShaderDefines& defines = {})
+{
+    auto compile = [](const std::string& source, std::string* log) -> std::shared_ptr<void>
+    {
+        auto shader = std::make_shared<Shader<_type>>();
+        shader->Source(source.c_str());
+        if (shader->Compile()) return shader;
+
+        *log = shader->GetInfoLog();
+        return nullptr;
+    };
+    auto attach = [](Program& program, const void* shader)
+    {
+        program.Attach(*static_cast<const Shader<_type>*>(shader));
+    };
+    return {_type, path, defines, compile, attach};
+}
+
+/**
+ * @brief Rebuilds programs when their shader files change
+ *
+ * Every file a stage is expanded from, includes too, is watched. `Update()`
+ * recompiles only the stages whose files changed, each once no matter how
+ * many programs share it, and relinks only the programs using them. A
+ * relinked program replaces the previous one only if every stage compiled
+ * and it linked successfully, otherwise the previous one is kept.
+ *
+ * @tparam P The program type, e.g. `Program` or `ShaderManager`
+ *
+ * @note Programs are replaced, so get them through `Get` rather than keeping pointers
+ */
+template <typename P = ShaderManager>
+class ShaderReloader
+{
+  protected:
+    struct Compiled
+    {
+        ShaderStage stage;
+        std::vector<std::filesystem::path> files;
+        std::shared_ptr<void> shader;
+        bool failed;
+    };
+
+    struct Linked
+    {
+        std::vector<Compiled*> stages;
+        std::unique_ptr<P> program;
+    };
+
+    ShaderPreprocessor& m_preprocessor;
+    FileWatcher m_watcher = {};
+    std::unordered_map<uint64_t, std::unique_ptr<Compiled>> m_compiled = {};
+    std::vector<Linked> m_linked = {};
+    std::vector<std::string> m_errors = {};
+
+  public:
+    explicit ShaderReloader(ShaderPreprocessor& preprocessor)
+        : m_preprocessor(preprocessor) { }
+
+    ShaderReloader(const ShaderReloader& other) = delete;
+    ShaderReloader& operator=(const ShaderReloader& other) = delete;
+    ShaderReloader(ShaderReloader&& other) = delete;
+
+    /**
+     * @brief Builds a program and starts watching its files
+     *
+     * @param stages The program's stages, see `MakeShaderStage`
+     * @return The program's id for `Get`, also if building failed
+     */
+    size_t Add(const std::vector<ShaderStage>& stages)
+    {
+        m_errors.clear();
+
+        Linked linked;
+        for (const ShaderStage& stage : stages)
+        {
+            uint64_t key = HashCombine(VariantKey(stage.path.string(), stage.defines), stage.type);
+            auto it = m_compiled.find(key);
+            if (it == m_compiled.end())
+            {
+                auto compiled = std::make_unique<Compiled>(Compiled{stage, {}, nullptr, false});
+                Compile(*compiled);
+                it = m_compiled.emplace(key, std::move(compiled)).first;
+            }
+            linked.stages.push_back(it->second.get());
+        }
+
+        Relink(linked);
+        m_linked.push_back(std::move(linked));
+        return m_linked.size() - 1;
+    }
+
+    /// @brief Gets a program, or `nullptr` if it never built successfully
+    inline P* Get(size_t id) const { return m_linked[id].program.get(); }
+
+    /// @brief Returns the compile and link errors of the last `Add` or `Update`
+    inline const std::vector<std::string>& Errors() const { return m_errors; }
+
+    /**
+     * @brief Rebuilds the programs affected by changed files
+     *
+     * @return The number of programs replaced
+     */
+    size_t Update()
+    {
+        std::vector<std::filesystem::path> changed = m_watcher.Poll();
+        if (changed.empty()) return 0;
+
+        m_errors.clear();
+        std::unordered_set<std::string> files;
+        for (const std::filesystem::path& file : changed)
+        {
+            m_preprocessor.Invalidate(file);
+            files.insert(file.string());
+        }
+
+        std::unordered_set<Compiled*> recompiled;
+        for (auto& [key, compiled] : m_compiled)
+        {
+            for (const std::filesystem::path& file : compiled->files)
+            {
+                if (!files.count(file.string())) continue;
+
+                Compile(*compiled);
+                recompiled.insert(compiled.get());
+                break;
+            }
+        }
+
+        size_t replaced = 0;
+        for (Linked& linked : m_linked)
+        {
+            bool affected = !linked.program;
+            for (Compiled* stage : linked.stages) affected = affected || recompiled.count(stage);
+            if (affected && Relink(linked)) replaced++;
+        }
+        return replaced;
+    }
+
+  protected:
+    void Compile(Compiled& compiled)
+    {
+        PreprocessedSource source = m_preprocessor.Process(compiled.stage.path, compiled.stage.defines);
+
+        // keep watching the old files, the broken one may be fixed later
+        for (const std::filesystem::path& file : source.files)
+        {
+            m_watcher.Watch(file);
+            if (std::find(compiled.files.begin(), compiled.files.end(), file) == compiled.files.end())
+                compiled.files.push_back(file);
+        }
+        if (source.files.empty() && compiled.files.empty())
+        {
+            m_watcher.Watch(compiled.stage.path);
+            compiled.files.push_back(FileWatcher::Normalize(compiled.stage.path));
+        }
+
+        if (!source)
+        {
+            compiled.failed = true;
+            m_errors.push_back(std::move(source.error));
+            return;
+        }
+
+        std::string log;
+        std::shared_ptr<void> shader = compiled.stage.compile(source.source, &log);
+        compiled.failed = shader == nullptr;
+        if (compiled.failed)
+        {
+            m_errors.push_back(compiled.stage.path.string() + ": " + log);
+            return;
+        }
+        compiled.shader = std::move(shader);
+    }
+
+    bool Relink(Linked& linked)
+    {
+        for (Compiled* stage : linked.stages)
+            if (stage->failed || !stage->shader) return false;
+
+        auto program = std::make_unique<P>();
+        for (Compiled* stage : linked.stages) stage->stage.attach(*program, stage->shader.get());
+
+        if (!program->Link())
+        {
+            m_errors.push_back(program->GetInfoLog());
+            return false;
+        }
+
+        linked.program = std::move(program);
+        return true;
+    }
+};
+
+} // namespace glwrap
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstring>
+#include <memory>
+
+#include "glwrap/include_gl.h"
+
+#ifndef GL_VERSION_4_4
+#error "OpenGL 4.4 is required to use StreamingBuffer"
+#endif
+
+#include "glwrap/buffer.hpp"
+#include "glwrap/sync.hpp"
+
+namespace glwrap
+{
+
+/**
+ * @brief A persistently mapped ring buffer for per-frame data
+ *
+ * The data store is split into one region per frame in flight. Allocations
+ * are carved out of the current region and written to directly, and
+ * `NextFrame()` fences the region so it is only reused once the GPU is done
+ * with it.
+ *
+ * @tparam _target The target for `glBindBuffer`
+ * @tparam _binding The binding for `glGet`
+ *
+ * @warning The data store is immutable, do not call `Store` on it
+ */
+template <GLenum _target, GLenum _binding>
+class StreamingBuffer : public Buffer<_target, _binding>
+{
+  public:
+    /// @brief A range of the current region
+    struct Allocation
+    {
+        /// @brief A pointer to the mapped range, or `nullptr` if the region is exhausted
+        void* data = nullptr;
+        /// @brief The offset of the range into the buffer, in bytes
+        GLintptr offset = 0;
+        /// @brief The size of the range, in bytes
+        GLsizeiptr size = 0;
+
+        inline explicit operator bool() const { return data != nullptr; }
+    };
+
+    static constexpr GLbitfield FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  protected:
+    GLsizeiptr m_regionSize;
+    GLuint m_regions;
+    GLuint m_region = 0;
+    GLsizeiptr m_head = 0;
+    char* m_mapping = nullptr;
+    std::unique_ptr<Fence[]> m_fences;
+    uint64_t m_stalls = 0;
+
+  public:
+    /**
+     * @brief Creates and maps the data store
+     * @see glBufferStorage
+     * @see glMapBufferRange
+     *
+     * @param regionSize The size in bytes available per frame
+     * @param regions The number of frames in flight
+     */
+    StreamingBuffer(GLsizeiptr regionSize, GLuint regions = 3)
+        : m_regionSize(regionSize), m_regions(regions), m_fences(new Fence[regions])
+    {
+        this->Storage(regionSize * regions, FLAGS, nullptr);
+        m_mapping = static_cast<char*>(this->MapRange(0, regionSize * regions, FLAGS));
+    }
+
+    /// @brief Returns the size in bytes available per frame
+    inline GLsizeiptr RegionSize() const { return m_regionSize; }
+
+    /// @brief Returns the number of frames in flight
+    inline GLuint Regions() const { return m_regions; }
+
+    /// @brief Returns the index of the region allocations are made from
+    inline GLuint CurrentRegion() const { return m_region; }
+
+    /// @brief Returns the number of bytes left in the current region
+    inline GLsizeiptr Remaining() const { return m_regionSize - m_head; }
+
+    /// @brief Returns how often `NextFrame()` had to wait for the GPU
+    inline uint64_t Stalls() const { return m_stalls; }
+
+    /**
+     * @brief Allocates a range from the current region
+     *
+     * @param size The size of the range in bytes
+     * @param alignment The alignment of the range's offset into the buffer,
+     * e.g. `GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT`
+     * @return The allocation, empty if the region is exhausted
+     */
+    Allocation Allocate(GLsizeiptr size, GLsizeiptr alignment = 1)
+    {
+        GLintptr base = m_region * m_regionSize;
+        GLintptr offset = (base + m_head + alignment - 1) / alignment * alignment;
+        if (offset + size > base + m_regionSize) return {};
+
+        m_head = offset + size - base;
+        return {m_mapping + offset, offset, size};
+    }
+
+    /**
+     * @brief Allocates a range and copies data into it
+     *
+     * @param data The data to copy
+     * @param size The size of the data in bytes
+     * @param alignment The alignment of the range's offset into the buffer
+     * @return The allocation, empty if the region is exhausted
+     */
+    Allocation Push(const void* data, GLsizeiptr size, GLsizeiptr alignment = 1)
+    {
+        Allocation allocation = Allocate(size, alignment);
+        if (allocation) memcpy(allocation.data, data, size);
+        return allocation;
+    }
+
+    /**
+     * @brief Fences the current region and moves on to the next one
+     * @see glFenceSync
+     *
+     * @note This function blocks if the GPU is still using the next region
+     */
+    void NextFrame()
+    {
+        m_fences[m_region].Insert();
+        m_region = (m_region + 1) % m_regions;
+        m_head = 0;
+
+        Fence& fence = m_fences[m_region];
+        if (!fence.IsSignaled())
+        {
+            m_stalls++;
+            fence.Wait();
+        }
+        fence.Reset();
+    }
+};
+
+/// @brief A streaming buffer with target `GL_ARRAY_BUFFER`
+using StreamingArrayBuffer = StreamingBuffer<GL_ARRAY_BUFFER, GL_ARRAY_BUFFER_BINDING>;
+
+/// @brief A streaming buffer with target `GL_ELEMENT_ARRAY_BUFFER`
+using StreamingElementArrayBuffer = StreamingBuffer<GL_ELEMENT_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER_BINDING>;
+
+} // namespace glwrap
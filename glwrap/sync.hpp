@@ -0,0 +1,119 @@
+#pragma once
+
+#include "glwrap/include_gl.h"
+
+#ifndef GL_VERSION_3_2
+#error "OpenGL 3.2 is required to use Fence"
+#endif
+
+namespace glwrap
+{
+
+/**
+ * @brief A fence sync object
+ */
+class Fence
+{
+  protected:
+    GLsync m_sync = nullptr;
+
+  public:
+    Fence() = default;
+    ~Fence() { Reset(); }
+
+    /// @warning Deleted to prevent double deletion, use `std::unique_ptr` instead
+    Fence(const Fence& other) = delete;
+    Fence& operator=(const Fence& other) = delete;
+    Fence(Fence&& other) = delete;
+
+    inline GLsync Handle() const { return m_sync; }
+
+    /// @brief Returns whether the fence has been inserted and not reset since
+    inline bool IsInserted() const { return m_sync != nullptr; }
+
+    /**
+     * @brief Inserts the fence into the command stream, replacing the previous one
+     * @see glFenceSync
+     */
+    void Insert()
+    {
+        Reset();
+        m_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+
+    /**
+     * @brief Deletes the fence
+     * @see glDeleteSync
+     */
+    void Reset()
+    {
+        if (m_sync) glDeleteSync(m_sync);
+        m_sync = nullptr;
+    }
+
+    /**
+     * @brief Returns whether the fence has been signaled, without blocking
+     * @see glGetSynciv
+     *
+     * @note A fence that has not been inserted counts as signaled
+     */
+    bool IsSignaled() const
+    {
+        if (!m_sync) return true;
+
+        GLint status;
+        glGetSynciv(m_sync, GL_SYNC_STATUS, 1, nullptr, &status);
+        return status == GL_SIGNALED;
+    }
+
+    /**
+     * @brief Blocks until the fence is signaled or the timeout expires
+     * @see glClientWaitSync
+     *
+     * @param timeout The timeout in nanoseconds
+     * @return Whether the fence was signaled
+     */
+    bool Wait(GLuint64 timeout) const
+    {
+        if (!m_sync) return true;
+
+        GLenum result = glClientWaitSync(m_sync, GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+        return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+    }
+
+    /// @brief Blocks until the fence is signaled
+    void Wait() const
+    {
+        if (!m_sync) return;
+
+        GLenum result = glClientWaitSync(m_sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        while (result == GL_TIMEOUT_EXPIRED)
+            result = glClientWaitSync(m_sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    }
+};
+
+#ifdef GL_VERSION_4_2
+/**
+ * @brief Orders memory accesses of shaders before the barrier with accesses after it
+ * @see glMemoryBarrier
+ *
+ * @param barriers The accesses to order, e.g. `GL_SHADER_STORAGE_BARRIER_BIT`
+ */
+inline void Barrier(GLbitfield barriers)
+{
+    glMemoryBarrier(barriers);
+}
+#endif
+
+#ifdef GL_VERSION_4_5
+/**
+ * @brief Orders memory accesses of fragment shaders within the same framebuffer region
+ * @see glMemoryBarrierByRegion
+ */
+inline void BarrierByRegion(GLbitfield barriers)
+{
+    glMemoryBarrierByRegion(barriers);
+}
+#endif
+
+} // namespace glwrap
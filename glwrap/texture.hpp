@@ -1,11 +1,73 @@
 #pragma once
 
 #include "glwrap/include_gl.h"
+#include "glwrap/features.hpp"
 #include "glwrap/object.hpp"
 
 namespace glwrap
 {
 
+/**
+ * @brief Gets the size in bytes of a pixel in client memory, or 0 if unknown
+ *
+ * @param format The format of the pixel data, e.g. `GL_RGBA`
+ * @param type The data type of the pixel data, e.g. `GL_UNSIGNED_BYTE`
+ */
+constexpr GLsizei GetPixelSize(GLenum format, GLenum type)
+{
+    GLsizei components = 0;
+    switch (format)
+    {
+        case GL_RED:
+        case GL_GREEN:
+        case GL_BLUE:
+        case GL_RED_INTEGER:
+        case GL_DEPTH_COMPONENT:
+        case GL_STENCIL_INDEX:   components = 1; break;
+        case GL_RG:
+        case GL_RG_INTEGER:
+        case GL_DEPTH_STENCIL:   components = 2; break;
+        case GL_RGB:
+        case GL_BGR:
+        case GL_RGB_INTEGER:
+        case GL_BGR_INTEGER:     components = 3; break;
+        case GL_RGBA:
+        case GL_BGRA:
+        case GL_RGBA_INTEGER:
+        case GL_BGRA_INTEGER:    components = 4; break;
+        default:                 return 0;
+    }
+
+    switch (type)
+    {
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:                 return components;
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT:                    return components * 2;
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+        case GL_FLOAT:                         return components * 4;
+        case GL_UNSIGNED_BYTE_3_3_2:
+        case GL_UNSIGNED_BYTE_2_3_3_REV:       return 1;
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_5_6_5_REV:
+        case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+        case GL_UNSIGNED_SHORT_5_5_5_1:
+        case GL_UNSIGNED_SHORT_1_5_5_5_REV:    return 2;
+        case GL_UNSIGNED_INT_8_8_8_8:
+        case GL_UNSIGNED_INT_8_8_8_8_REV:
+        case GL_UNSIGNED_INT_10_10_10_2:
+        case GL_UNSIGNED_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_24_8:
+        case GL_UNSIGNED_INT_10F_11F_11F_REV:
+        case GL_UNSIGNED_INT_5_9_9_9_REV:      return 4;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return 8;
+        default:                               return 0;
+    }
+}
+
 /**
  * @brief A texture object
  *
@@ -15,31 +77,65 @@ namespace glwrap
 template <GLenum _target, GLenum _binding>
 class Texture : public Object<_binding>
 {
+  protected:
+    using Object<_binding>::m_handle;
+    using Object<_binding>::Track;
+    using Object<_binding>::Forget;
+
+    bool m_direct = false;
+
   public:
     static constexpr GLenum TARGET = _target;
 
-    Texture() { glGenTextures(1, &m_handle); }
-    ~Texture() { glDeleteTextures(1, &m_handle); }
+    Texture()
+    {
+#ifdef GLWRAP_DSA
+        if (Features::DirectStateAccess())
+        {
+            glCreateTextures(TARGET, 1, &m_handle);
+            m_direct = true;
+            return;
+        }
+#endif
+        glGenTextures(1, &m_handle);
+    }
+    ~Texture()
+    {
+        Forget(m_handle);
+        glDeleteTextures(1, &m_handle);
+    }
 
     /// @warning Deleted to prevent double deletion, use `std::unique_ptr` instead
     Texture(const Texture& other) = delete;
     Texture& operator=(const Texture& other) = delete;
     Texture(Texture&& other) = delete;
 
-    void Bind() const { glBindTexture(TARGET, m_handle); }
+    /**
+     * @brief Returns whether the texture was created with `glCreateTextures` and is edited with
+     * direct state access, decided once when it is created
+     */
+    inline bool IsDirect() const { return m_direct; }
+
+
+    /// @note Binding is skipped if the texture is already bound to the active unit
+    void Bind() const
+    {
+        if (Track(m_handle)) glBindTexture(TARGET, m_handle);
+    }
     void Bind(GLenum unit) const
     {
-        glActiveTexture(GL_TEXTURE0 + unit);
-        glBindTexture(TARGET, m_handle);
+        BindingCache::SetActiveUnit(unit);
+        Bind();
+    }
+    void Unbind() const
+    {
+        if (Track(0)) glBindTexture(TARGET, 0);
     }
-    void Unbind() const { glBindTexture(TARGET, 0); }
 
     /// @brief Gets active texture unit
     static GLint GetActiveUnit()
     {
-        GLint unit;
-        glGetIntegerv(GL_ACTIVE_TEXTURE, &unit);
-        return unit;
+        return GL_TEXTURE0 + BindingCache::GetActiveUnit();
     }
 
     /**
@@ -49,39 +145,108 @@ class Texture : public Object<_binding>
      * @param pname The parameter to set
      * @param param The value of the parameter
      *
-     * @note This function binds the texture
+     * @note This function binds the texture unless direct state access is used
      */
     void Parameter(GLenum pname, GLint param)
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureParameteri(m_handle, pname, param);
+            return;
+        }
+#endif
         Bind();
         glTexParameteri(TARGET, pname, param);
     }
     void Parameter(GLenum pname, GLfloat param)
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureParameterf(m_handle, pname, param);
+            return;
+        }
+#endif
         Bind();
         glTexParameterf(TARGET, pname, param);
     }
     void Parameter(GLenum pname, const GLint* params)
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureParameteriv(m_handle, pname, params);
+            return;
+        }
+#endif
         Bind();
         glTexParameteriv(TARGET, pname, params);
     }
     void Parameter(GLenum pname, const GLfloat* params)
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureParameterfv(m_handle, pname, params);
+            return;
+        }
+#endif
         Bind();
         glTexParameterfv(TARGET, pname, params);
     }
 
+    /**
+     * @brief Gets a parameter of a mipmap level
+     * @see glGetTexLevelParameter
+     *
+     * @param level The level-of-detail number
+     * @param pname The parameter to get, e.g. `GL_TEXTURE_WIDTH`
+     *
+     * @note For cube maps this queries the first face, all faces share their size and format
+     * @note This function binds the texture unless direct state access is used
+     */
+    GLint GetLevelParameter(GLint level, GLenum pname) const
+    {
+        // glGetTexLevelParameter takes a face rather than the cube map target
+        constexpr GLenum target = TARGET == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X : TARGET;
+
+        GLint param;
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glGetTextureLevelParameteriv(m_handle, level, pname, &param);
+            return param;
+        }
+#endif
+        Bind();
+        glGetTexLevelParameteriv(target, level, pname, &param);
+        return param;
+    }
+
     /**
      * @brief Generate a mipmap for this texture
-     * @see glGenerateTextureMipmap
+     * @see glGenerateMipmap
+     *
+     * @note This function binds the texture unless direct state access is used
      */
     void GenerateMipmap()
     {
-        glGenerateTextureMipmap(m_handle);
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glGenerateTextureMipmap(m_handle);
+            return;
+        }
+#endif
+        Bind();
+        glGenerateMipmap(TARGET);
     }
 };
 
+/**
+ * @brief A one-dimensional texture
+ */
 class Texture1D : public Texture<GL_TEXTURE_1D, GL_TEXTURE_BINDING_1D>
 {
   public:
@@ -96,18 +261,82 @@ class Texture1D : public Texture<GL_TEXTURE_1D, GL_TEXTURE_BINDING_1D>
      * @param type The data type of the pixel data
      * @param data The image data
      *
-     * @note This function binds the buffer
+     * @note This function binds the texture
      */
     void Image(GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data)
     {
         Bind();
         glTexImage1D(TARGET, level, internalFormat, width, 0, format, type, data);
     }
+
+#ifdef GL_VERSION_4_2
+    /**
+     * @brief Allocates immutable storage for all levels of the texture
+     * @see glTexStorage1D
+     *
+     * @param levels The number of texture levels
+     * @param internalFormat The sized internal format, e.g. `GL_RGBA8`
+     * @param width The width of the base level
+     *
+     * @note This function binds the texture unless direct state access is used
+     */
+    void Storage(GLsizei levels, GLenum internalFormat, GLsizei width)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureStorage1D(m_handle, levels, internalFormat, width);
+            return;
+        }
+#endif
+        Bind();
+        glTexStorage1D(TARGET, levels, internalFormat, width);
+    }
+#endif
+
+    /**
+     * @brief Replaces a region of a texture level
+     * @see glTexSubImage1D
+     *
+     * @param level The level-of-detail number
+     * @param x The texel offset of the region
+     * @param width The width of the region
+     * @param format The format of the pixel data
+     * @param type The data type of the pixel data
+     * @param data The image data, or an offset into the bound `PixelUnpackBuffer`
+     *
+     * @note This function binds the texture unless direct state access is used
+     */
+    void SubImage(GLint level, GLint x, GLsizei width, GLenum format, GLenum type, const GLvoid* data)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureSubImage1D(m_handle, level, x, width, format, type, data);
+            return;
+        }
+#endif
+        Bind();
+        glTexSubImage1D(TARGET, level, x, width, format, type, data);
+    }
 };
 
-class Texture2D : public Texture<GL_TEXTURE_2D, GL_TEXTURE_BINDING_2D>
+/**
+ * @brief A texture addressed with two coordinates, a 2D texture or 1D array texture
+ *
+ * @tparam _target The target of the texture
+ * @tparam _binding The binding point of the texture
+ */
+template <GLenum _target, GLenum _binding>
+class Texture2DBase : public Texture<_target, _binding>
 {
+  protected:
+    using Texture<_target, _binding>::m_handle;
+    using Texture<_target, _binding>::m_direct;
+
   public:
+    using Texture<_target, _binding>::Bind;
+
     /**
      * @brief Set the texture image
      * @see glTexImage2D
@@ -115,23 +344,90 @@ class Texture2D : public Texture<GL_TEXTURE_2D, GL_TEXTURE_BINDING_2D>
      * @param level The level-of-detail number
      * @param internalFormat The number of color components in the texture
      * @param width The width of the texture image
-     * @param height The height of the texture image
+     * @param height The height of the texture image, or the number of layers
      * @param format The format of the pixel data
      * @param type The data type of the pixel data
      * @param data The image data
      *
-     * @note This function binds the buffer
+     * @note This function binds the texture
      */
     void Image(GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data)
     {
         Bind();
-        glTexImage2D(TARGET, level, internalFormat, width, height, 0, format, type, data);
+        glTexImage2D(_target, level, internalFormat, width, height, 0, format, type, data);
+    }
+
+#ifdef GL_VERSION_4_2
+    /**
+     * @brief Allocates immutable storage for all levels of the texture
+     * @see glTexStorage2D
+     *
+     * @param levels The number of texture levels
+     * @param internalFormat The sized internal format, e.g. `GL_RGBA8`
+     * @param width The width of the base level
+     * @param height The height of the base level, or the number of layers
+     *
+     * @note This function binds the texture unless direct state access is used
+     */
+    void Storage(GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureStorage2D(m_handle, levels, internalFormat, width, height);
+            return;
+        }
+#endif
+        Bind();
+        glTexStorage2D(_target, levels, internalFormat, width, height);
+    }
+#endif
+
+    /**
+     * @brief Replaces a region of a texture level
+     * @see glTexSubImage2D
+     *
+     * @param level The level-of-detail number
+     * @param x The x texel offset of the region
+     * @param y The y texel offset of the region, or the first layer
+     * @param width The width of the region
+     * @param height The height of the region, or the number of layers
+     * @param format The format of the pixel data
+     * @param type The data type of the pixel data
+     * @param data The image data, or an offset into the bound `PixelUnpackBuffer`
+     *
+     * @note This function binds the texture unless direct state access is used
+     */
+    void SubImage(GLint level, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureSubImage2D(m_handle, level, x, y, width, height, format, type, data);
+            return;
+        }
+#endif
+        Bind();
+        glTexSubImage2D(_target, level, x, y, width, height, format, type, data);
     }
 };
 
-class Texture3D : public Texture<GL_TEXTURE_3D, GL_TEXTURE_BINDING_3D>
+/**
+ * @brief A texture addressed with three coordinates, a 3D texture or 2D array texture
+ *
+ * @tparam _target The target of the texture
+ * @tparam _binding The binding point of the texture
+ */
+template <GLenum _target, GLenum _binding>
+class Texture3DBase : public Texture<_target, _binding>
 {
+  protected:
+    using Texture<_target, _binding>::m_handle;
+    using Texture<_target, _binding>::m_direct;
+
   public:
+    using Texture<_target, _binding>::Bind;
+
     /**
      * @brief Set the texture image
      * @see glTexImage3D
@@ -140,22 +436,182 @@ class Texture3D : public Texture<GL_TEXTURE_3D, GL_TEXTURE_BINDING_3D>
      * @param internalFormat The number of color components in the texture
      * @param width The width of the texture image
      * @param height The height of the texture image
-     * @param depth The depth of the texture image
+     * @param depth The depth of the texture image, or the number of layers
      * @param format The format of the pixel data
      * @param type The data type of the pixel data
      * @param data The image data
      *
-     * @note This function binds the buffer
+     * @note This function binds the texture
      */
     void Image(GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid* data)
     {
         Bind();
-        glTexImage3D(TARGET, level, internalFormat, width, height, depth, 0, format, type, data);
+        glTexImage3D(_target, level, internalFormat, width, height, depth, 0, format, type, data);
+    }
+
+#ifdef GL_VERSION_4_2
+    /**
+     * @brief Allocates immutable storage for all levels of the texture
+     * @see glTexStorage3D
+     *
+     * @param levels The number of texture levels
+     * @param internalFormat The sized internal format, e.g. `GL_RGBA8`
+     * @param width The width of the base level
+     * @param height The height of the base level
+     * @param depth The depth of the base level, or the number of layers
+     *
+     * @note This function binds the texture unless direct state access is used
+     */
+    void Storage(GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureStorage3D(m_handle, levels, internalFormat, width, height, depth);
+            return;
+        }
+#endif
+        Bind();
+        glTexStorage3D(_target, levels, internalFormat, width, height, depth);
     }
+#endif
+
+    /**
+     * @brief Replaces a region of a texture level
+     * @see glTexSubImage3D
+     *
+     * @param level The level-of-detail number
+     * @param x The x texel offset of the region
+     * @param y The y texel offset of the region
+     * @param z The z texel offset of the region, or the first layer
+     * @param width The width of the region
+     * @param height The height of the region
+     * @param depth The depth of the region, or the number of layers
+     * @param format The format of the pixel data
+     * @param type The data type of the pixel data
+     * @param data The image data, or an offset into the bound `PixelUnpackBuffer`
+     *
+     * @note This function binds the texture unless direct state access is used
+     */
+    void SubImage(GLint level, GLint x, GLint y, GLint z, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid* data)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureSubImage3D(m_handle, level, x, y, z, width, height, depth, format, type, data);
+            return;
+        }
+#endif
+        Bind();
+        glTexSubImage3D(_target, level, x, y, z, width, height, depth, format, type, data);
+    }
+};
+
+/// @brief A two-dimensional texture
+class Texture2D : public Texture2DBase<GL_TEXTURE_2D, GL_TEXTURE_BINDING_2D>
+{
+};
+
+/// @brief A three-dimensional texture
+class Texture3D : public Texture3DBase<GL_TEXTURE_3D, GL_TEXTURE_BINDING_3D>
+{
+};
+
+/// @brief An array of one-dimensional textures, layers are addressed with y
+class Texture1DArray : public Texture2DBase<GL_TEXTURE_1D_ARRAY, GL_TEXTURE_BINDING_1D_ARRAY>
+{
 };
 
-using Texture1DArray = Texture<GL_TEXTURE_1D_ARRAY, GL_TEXTURE_BINDING_1D_ARRAY>;
-using Texture2DArray = Texture<GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BINDING_2D_ARRAY>;
-using TextureCubeMap = Texture<GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BINDING_CUBE_MAP>;
+/// @brief An array of two-dimensional textures, layers are addressed with z
+class Texture2DArray : public Texture3DBase<GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BINDING_2D_ARRAY>
+{
+};
+
+/**
+ * @brief A cube map texture
+ *
+ * Faces are given as `GL_TEXTURE_CUBE_MAP_POSITIVE_X` through `GL_TEXTURE_CUBE_MAP_NEGATIVE_Z`
+ */
+class TextureCubeMap : public Texture<GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BINDING_CUBE_MAP>
+{
+  public:
+    /**
+     * @brief Set the image of a face
+     * @see glTexImage2D
+     *
+     * @param face The face to set
+     * @param level The level-of-detail number
+     * @param internalFormat The number of color components in the texture
+     * @param width The width of the face image
+     * @param height The height of the face image
+     * @param format The format of the pixel data
+     * @param type The data type of the pixel data
+     * @param data The image data
+     *
+     * @note This function binds the texture
+     */
+    void Image(GLenum face, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data)
+    {
+        Bind();
+        glTexImage2D(face, level, internalFormat, width, height, 0, format, type, data);
+    }
+
+#ifdef GL_VERSION_4_2
+    /**
+     * @brief Allocates immutable storage for all faces and levels of the texture
+     * @see glTexStorage2D
+     *
+     * @param levels The number of texture levels
+     * @param internalFormat The sized internal format, e.g. `GL_RGBA8`
+     * @param width The width of the base level faces
+     * @param height The height of the base level faces
+     *
+     * @note This function binds the texture unless direct state access is used
+     */
+    void Storage(GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glTextureStorage2D(m_handle, levels, internalFormat, width, height);
+            return;
+        }
+#endif
+        Bind();
+        glTexStorage2D(TARGET, levels, internalFormat, width, height);
+    }
+#endif
+
+    /**
+     * @brief Replaces a region of a face
+     * @see glTexSubImage2D
+     *
+     * @param face The face to update
+     * @param level The level-of-detail number
+     * @param x The x texel offset of the region
+     * @param y The y texel offset of the region
+     * @param width The width of the region
+     * @param height The height of the region
+     * @param format The format of the pixel data
+     * @param type The data type of the pixel data
+     * @param data The image data, or an offset into the bound `PixelUnpackBuffer`
+     *
+     * @note This function binds the texture unless direct state access is used
+     */
+    void SubImage(GLenum face, GLint level, GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid* data)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            // cube maps are addressed as six layers with direct state access
+            GLint layer = static_cast<GLint>(face - GL_TEXTURE_CUBE_MAP_POSITIVE_X);
+            glTextureSubImage3D(m_handle, level, x, y, layer, width, height, 1, format, type, data);
+            return;
+        }
+#endif
+        Bind();
+        glTexSubImage2D(face, level, x, y, width, height, format, type, data);
+    }
+};
 
 } // namespace glwrap
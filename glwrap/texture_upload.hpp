@@ -0,0 +1,296 @@
+#pragma once
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+
+#ifndef GL_VERSION_4_4
+#error "OpenGL 4.4 is required to use TextureUploader"
+#endif
+
+#include "glwrap/buffer.hpp"
+#include "glwrap/sync.hpp"
+#include "glwrap/texture.hpp"
+
+namespace glwrap
+{
+
+/**
+ * @brief Asynchronous texture uploads through persistently mapped pixel unpack buffers
+ *
+ * Worker threads acquire staging memory, fill it with texel data and submit
+ * it together with the destination. The GL thread then issues all submitted
+ * uploads with `Flush()`, which sources them from the staging buffers and
+ * recycles the buffers once their fences signal.
+ *
+ * Acquired staging memory must either be submitted or given back with
+ * `Release`, otherwise its buffer is never recycled.
+ *
+ * `Acquire`, `TryAcquire`, `Release` and `Submit` may be called from any
+ * thread, all other functions must be called on the GL thread.
+ */
+class TextureUploader
+{
+  public:
+    /// @brief Staging memory for a single upload
+    struct Staging
+    {
+        /// @brief A pointer to the staging memory, or `nullptr` if none was available
+        void* data = nullptr;
+        /// @brief The size of the staging memory, in bytes
+        GLsizeiptr size = 0;
+        /// @brief The index of the staging buffer
+        size_t slot = 0;
+
+        inline explicit operator bool() const { return data != nullptr; }
+    };
+
+    static constexpr GLbitfield FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+  protected:
+    enum class SlotState
+    {
+        Free,
+        Staged,
+        InFlight,
+    };
+
+    struct Slot
+    {
+        PixelUnpackBuffer buffer;
+        Fence fence;
+        void* mapping = nullptr;
+        SlotState state = SlotState::Free;
+    };
+
+    struct Upload
+    {
+        size_t slot;
+        void* texture;
+        void (*apply)(const Upload& upload, const void* pixels);
+        GLint level;
+        GLint x, y, z;
+        GLsizei width, height, depth;
+        GLenum format, type;
+    };
+
+    GLsizeiptr m_slotSize;
+    std::vector<std::unique_ptr<Slot>> m_slots;
+    std::vector<Upload> m_queue;
+    std::vector<Upload> m_pending;
+    std::mutex m_mutex;
+    std::condition_variable m_freed;
+
+  public:
+    /**
+     * @brief Creates and maps the staging buffers
+     * @see glBufferStorage
+     *
+     * @param slots The number of staging buffers
+     * @param slotSize The size in bytes of each staging buffer
+     */
+    TextureUploader(size_t slots, GLsizeiptr slotSize)
+        : m_slotSize(slotSize)
+    {
+        for (size_t i = 0; i < slots; i++)
+        {
+            auto slot = std::make_unique<Slot>();
+            slot->buffer.Storage(slotSize, FLAGS, nullptr);
+            slot->mapping = slot->buffer.MapRange(0, slotSize, FLAGS);
+            slot->buffer.Unbind();
+            m_slots.push_back(std::move(slot));
+        }
+    }
+
+    TextureUploader(const TextureUploader& other) = delete;
+    TextureUploader& operator=(const TextureUploader& other) = delete;
+    TextureUploader(TextureUploader&& other) = delete;
+
+    /// @brief Returns the size in bytes of each staging buffer
+    inline GLsizeiptr SlotSize() const { return m_slotSize; }
+
+    /**
+     * @brief Acquires staging memory without blocking
+     *
+     * @param size The size in bytes of the texel data
+     * @return The staging memory, empty if all buffers are in use or `size` is too large
+     */
+    Staging TryAcquire(GLsizeiptr size)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return AcquireLocked(size);
+    }
+
+    /**
+     * @brief Acquires staging memory, waiting for a buffer to be recycled
+     *
+     * @param size The size in bytes of the texel data
+     * @return The staging memory, empty only if `size` is too large
+     *
+     * @warning Do not call this on the GL thread, only `Flush()` recycles buffers
+     */
+    Staging Acquire(GLsizeiptr size)
+    {
+        if (size > m_slotSize) return {};
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        Staging staging;
+        m_freed.wait(lock, [&] { return (staging = AcquireLocked(size)).data != nullptr; });
+        return staging;
+    }
+
+    /**
+     * @brief Gives back staging memory that will not be submitted, e.g. if loading the texels failed
+     *
+     * @param staging The unsubmitted staging memory, empty staging memory is ignored
+     */
+    void Release(const Staging& staging)
+    {
+        if (!staging) return;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            Slot& slot = *m_slots[staging.slot];
+            if (slot.state != SlotState::Staged) return;
+            slot.state = SlotState::Free;
+        }
+        m_freed.notify_all();
+    }
+
+    /**
+     * @brief Submits filled staging memory for upload into a texture
+     * @see Texture2DBase::SubImage
+     *
+     * @param staging The staging memory holding the texel data
+     * @param texture The destination texture, must stay alive until `Flush()`
+     * @param level The level-of-detail number
+     * @param x The x offset of the region
+     * @param y The y offset of the region, or the first layer
+     * @param width The width of the region
+     * @param height The height of the region, or the number of layers
+     * @param format The format of the pixel data
+     * @param type The data type of the pixel data
+     */
+    template <GLenum _target, GLenum _binding>
+    void Submit(
+        const Staging& staging, Texture2DBase<_target, _binding>& texture, GLint level,
+        GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type
+    )
+    {
+        Enqueue({staging.slot, &texture, &Apply2D<_target, _binding>, level, x, y, 0, width, height, 1, format, type});
+    }
+
+    /// @see Texture1D::SubImage
+    void Submit(
+        const Staging& staging, Texture1D& texture, GLint level,
+        GLint x, GLsizei width, GLenum format, GLenum type
+    )
+    {
+        Enqueue({staging.slot, &texture, &Apply1D, level, x, 0, 0, width, 1, 1, format, type});
+    }
+
+    /// @see Texture3DBase::SubImage
+    template <GLenum _target, GLenum _binding>
+    void Submit(
+        const Staging& staging, Texture3DBase<_target, _binding>& texture, GLint level,
+        GLint x, GLint y, GLint z, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type
+    )
+    {
+        Enqueue({staging.slot, &texture, &Apply3D<_target, _binding>, level, x, y, z, width, height, depth, format, type});
+    }
+
+    /**
+     * @brief Issues all submitted uploads and recycles completed staging buffers
+     * @see glFenceSync
+     *
+     * @return The number of uploads issued
+     *
+     * @note This function binds the destination textures and staging buffers
+     */
+    size_t Flush()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.swap(m_queue);
+        }
+
+        for (const Upload& upload : m_pending)
+        {
+            Slot& slot = *m_slots[upload.slot];
+            slot.buffer.Bind();
+            upload.apply(upload, nullptr);
+            slot.fence.Insert();
+        }
+
+        // leave client memory uploads working for the caller
+        if (!m_pending.empty()) m_slots.front()->buffer.Unbind();
+
+        size_t issued = m_pending.size();
+        bool freed = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const Upload& upload : m_pending) m_slots[upload.slot]->state = SlotState::InFlight;
+
+            for (auto& slot : m_slots)
+            {
+                if (slot->state != SlotState::InFlight || !slot->fence.IsSignaled()) continue;
+                slot->fence.Reset();
+                slot->state = SlotState::Free;
+                freed = true;
+            }
+        }
+        m_pending.clear();
+
+        if (freed) m_freed.notify_all();
+        return issued;
+    }
+
+  protected:
+    Staging AcquireLocked(GLsizeiptr size)
+    {
+        if (size > m_slotSize) return {};
+
+        for (size_t i = 0; i < m_slots.size(); i++)
+        {
+            Slot& slot = *m_slots[i];
+            if (slot.state != SlotState::Free) continue;
+
+            slot.state = SlotState::Staged;
+            return {slot.mapping, size, i};
+        }
+        return {};
+    }
+
+    void Enqueue(const Upload& upload)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(upload);
+    }
+
+    static void Apply1D(const Upload& upload, const void* pixels)
+    {
+        Texture1D& texture = *static_cast<Texture1D*>(upload.texture);
+        texture.SubImage(upload.level, upload.x, upload.width, upload.format, upload.type, pixels);
+    }
+
+    template <GLenum _target, GLenum _binding>
+    static void Apply2D(const Upload& upload, const void* pixels)
+    {
+        using Destination = Texture2DBase<_target, _binding>;
+        Destination& texture = *static_cast<Destination*>(upload.texture);
+        texture.SubImage(upload.level, upload.x, upload.y, upload.width, upload.height, upload.format, upload.type, pixels);
+    }
+
+    template <GLenum _target, GLenum _binding>
+    static void Apply3D(const Upload& upload, const void* pixels)
+    {
+        using Destination = Texture3DBase<_target, _binding>;
+        Destination& texture = *static_cast<Destination*>(upload.texture);
+        texture.SubImage(upload.level, upload.x, upload.y, upload.z, upload.width, upload.height, upload.depth, upload.format, upload.type, pixels);
+    }
+};
+
+} // namespace glwrap
@@ -0,0 +1,451 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "glwrap/include_gl.h"
+#include "glwrap/hash.hpp"
+
+namespace glwrap
+{
+
+/**
+ * @brief Gets the size in bytes of one element of a uniform type
+ *
+ * Opaque types such as samplers are set as a `GLint` texture unit.
+ *
+ * @param type The type as returned by `glGetActiveUniform`
+ */
+constexpr GLsizei GetUniformTypeSize(GLenum type)
+{
+    switch (type)
+    {
+        case GL_FLOAT:
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+        case GL_BOOL:              return 4;
+        case GL_FLOAT_VEC2:
+        case GL_INT_VEC2:
+        case GL_UNSIGNED_INT_VEC2:
+        case GL_BOOL_VEC2:         return 8;
+        case GL_FLOAT_VEC3:
+        case GL_INT_VEC3:
+        case GL_UNSIGNED_INT_VEC3:
+        case GL_BOOL_VEC3:         return 12;
+        case GL_FLOAT_VEC4:
+        case GL_INT_VEC4:
+        case GL_UNSIGNED_INT_VEC4:
+        case GL_BOOL_VEC4:
+        case GL_FLOAT_MAT2:        return 16;
+        case GL_FLOAT_MAT2x3:
+        case GL_FLOAT_MAT3x2:      return 24;
+        case GL_FLOAT_MAT2x4:
+        case GL_FLOAT_MAT4x2:      return 32;
+        case GL_FLOAT_MAT3:        return 36;
+        case GL_FLOAT_MAT3x4:
+        case GL_FLOAT_MAT4x3:      return 48;
+        case GL_FLOAT_MAT4:        return 64;
+#ifdef GL_VERSION_4_0
+        case GL_DOUBLE:            return 8;
+        case GL_DOUBLE_VEC2:       return 16;
+        case GL_DOUBLE_VEC3:       return 24;
+        case GL_DOUBLE_VEC4:
+        case GL_DOUBLE_MAT2:       return 32;
+        case GL_DOUBLE_MAT2x3:
+        case GL_DOUBLE_MAT3x2:     return 48;
+        case GL_DOUBLE_MAT2x4:
+        case GL_DOUBLE_MAT4x2:     return 64;
+        case GL_DOUBLE_MAT3:       return 72;
+        case GL_DOUBLE_MAT3x4:
+        case GL_DOUBLE_MAT4x3:     return 96;
+        case GL_DOUBLE_MAT4:       return 128;
+#endif
+        default:                   return 4;
+    }
+}
+
+/**
+ * @brief Returns whether a uniform type is opaque, e.g. a sampler or image
+ *
+ * @param type The type as returned by `glGetActiveUniform`
+ */
+constexpr bool IsOpaqueUniformType(GLenum type)
+{
+    switch (type)
+    {
+        case GL_FLOAT:
+        case GL_FLOAT_VEC2:
+        case GL_FLOAT_VEC3:
+        case GL_FLOAT_VEC4:
+        case GL_INT:
+        case GL_INT_VEC2:
+        case GL_INT_VEC3:
+        case GL_INT_VEC4:
+        case GL_UNSIGNED_INT:
+        case GL_UNSIGNED_INT_VEC2:
+        case GL_UNSIGNED_INT_VEC3:
+        case GL_UNSIGNED_INT_VEC4:
+        case GL_BOOL:
+        case GL_BOOL_VEC2:
+        case GL_BOOL_VEC3:
+        case GL_BOOL_VEC4:
+        case GL_FLOAT_MAT2:
+        case GL_FLOAT_MAT3:
+        case GL_FLOAT_MAT4:
+        case GL_FLOAT_MAT2x3:
+        case GL_FLOAT_MAT2x4:
+        case GL_FLOAT_MAT3x2:
+        case GL_FLOAT_MAT3x4:
+        case GL_FLOAT_MAT4x2:
+        case GL_FLOAT_MAT4x3:
+#ifdef GL_VERSION_4_0
+        case GL_DOUBLE:
+        case GL_DOUBLE_VEC2:
+        case GL_DOUBLE_VEC3:
+        case GL_DOUBLE_VEC4:
+        case GL_DOUBLE_MAT2:
+        case GL_DOUBLE_MAT3:
+        case GL_DOUBLE_MAT4:
+        case GL_DOUBLE_MAT2x3:
+        case GL_DOUBLE_MAT2x4:
+        case GL_DOUBLE_MAT3x2:
+        case GL_DOUBLE_MAT3x4:
+        case GL_DOUBLE_MAT4x2:
+        case GL_DOUBLE_MAT4x3:
+#endif
+            return false;
+        default:
+            return true;
+    }
+}
+
+/**
+ * @brief Maps a C++ type to the GLSL uniform type it sets
+ *
+ * `TYPE` is 0 for types without a mapping, these are only checked by size.
+ * Specialize this for the vector and matrix types of your math library, e.g.
+ *
+ *     template <> struct glwrap::UniformType<glm::vec3> { static constexpr GLenum TYPE = GL_FLOAT_VEC3; };
+ */
+template <typename T>
+struct UniformType
+{
+    static constexpr GLenum TYPE = 0;
+};
+
+template <GLenum _type>
+struct UniformTypeOf
+{
+    static constexpr GLenum TYPE = _type;
+};
+
+// clang-format off
+template <> struct UniformType<GLfloat> : UniformTypeOf<GL_FLOAT> {};
+template <> struct UniformType<GLint> : UniformTypeOf<GL_INT> {};
+template <> struct UniformType<GLuint> : UniformTypeOf<GL_UNSIGNED_INT> {};
+template <> struct UniformType<std::array<GLfloat, 2>> : UniformTypeOf<GL_FLOAT_VEC2> {};
+template <> struct UniformType<std::array<GLfloat, 3>> : UniformTypeOf<GL_FLOAT_VEC3> {};
+template <> struct UniformType<std::array<GLfloat, 4>> : UniformTypeOf<GL_FLOAT_VEC4> {};
+template <> struct UniformType<std::array<GLint, 2>> : UniformTypeOf<GL_INT_VEC2> {};
+template <> struct UniformType<std::array<GLint, 3>> : UniformTypeOf<GL_INT_VEC3> {};
+template <> struct UniformType<std::array<GLint, 4>> : UniformTypeOf<GL_INT_VEC4> {};
+template <> struct UniformType<std::array<GLuint, 2>> : UniformTypeOf<GL_UNSIGNED_INT_VEC2> {};
+template <> struct UniformType<std::array<GLuint, 3>> : UniformTypeOf<GL_UNSIGNED_INT_VEC3> {};
+template <> struct UniformType<std::array<GLuint, 4>> : UniformTypeOf<GL_UNSIGNED_INT_VEC4> {};
+template <> struct UniformType<std::array<GLfloat, 9>> : UniformTypeOf<GL_FLOAT_MAT3> {};
+template <> struct UniformType<std::array<GLfloat, 16>> : UniformTypeOf<GL_FLOAT_MAT4> {};
+// clang-format on
+
+/// @brief Arrays of a vector or matrix type set array uniforms of that type,
+/// arrays of scalars (e.g. `GLfloat[16]`) are only checked by size
+template <typename T, size_t N>
+struct UniformType<T[N]> : std::conditional_t<std::is_arithmetic_v<T>, UniformTypeOf<0>, UniformType<T>>
+{
+};
+
+/**
+ * @brief Returns whether a value of type `T` can set a uniform
+ *
+ * @tparam T The C++ type of the value
+ * @param type The uniform's type as returned by `glGetActiveUniform`
+ * @param size The uniform's array size
+ */
+template <typename T>
+constexpr bool IsUniformCompatible(GLenum type, GLint size)
+{
+    GLsizei elementSize = GetUniformTypeSize(type);
+    if (sizeof(T) % elementSize != 0 || sizeof(T) / elementSize > static_cast<size_t>(size)) return false;
+
+    constexpr GLenum valueType = UniformType<T>::TYPE;
+    if (valueType == 0 || valueType == type) return true;
+
+    // booleans may be set as integers, opaque types as texture or image units
+    switch (type)
+    {
+        case GL_BOOL:      return valueType == GL_INT || valueType == GL_UNSIGNED_INT;
+        case GL_BOOL_VEC2: return valueType == GL_INT_VEC2 || valueType == GL_UNSIGNED_INT_VEC2;
+        case GL_BOOL_VEC3: return valueType == GL_INT_VEC3 || valueType == GL_UNSIGNED_INT_VEC3;
+        case GL_BOOL_VEC4: return valueType == GL_INT_VEC4 || valueType == GL_UNSIGNED_INT_VEC4;
+        default:           return IsOpaqueUniformType(type) && valueType == GL_INT;
+    }
+}
+
+/**
+ * @brief A uniform of a `ShaderManager` resolved ahead of time
+ *
+ * @tparam T The C++ type the uniform is set with, checked when resolving
+ *
+ * @note Handles are stamped with the manager and link they were resolved
+ * after, setting a handle on another manager or after linking again fails
+ */
+template <typename T>
+class UniformHandle
+{
+  protected:
+    int32_t m_index = -1;
+    uint64_t m_generation = 0;
+
+  public:
+    UniformHandle() = default;
+    UniformHandle(int32_t index, uint64_t generation) : m_index(index), m_generation(generation) {}
+
+    /// @brief Gets the index of the uniform in its `ShaderManager`
+    inline int32_t Index() const { return m_index; }
+
+    /// @brief Gets the link of its `ShaderManager` the handle was resolved after
+    inline uint64_t Generation() const { return m_generation; }
+
+    /// @brief Returns whether the uniform is active and matches `T`
+    inline bool IsValid() const { return m_index >= 0; }
+    inline explicit operator bool() const { return IsValid(); }
+};
+
+inline namespace literals
+{
+
+/// @brief Hashes a uniform name at compile time, e.g. `"u_mvp"_uniform`
+constexpr uint64_t operator""_uniform(const char* name, size_t length)
+{
+    return Hash(name, length);
+}
+
+} // namespace literals
+
+/**
+ * @brief Uploads uniform data to the current program
+ * @see glUniform
+ *
+ * @param location The location of the uniform
+ * @param type The type as returned by `glGetActiveUniform`
+ * @param count The number of array elements
+ * @param data The data, `count * GetUniformTypeSize(type)` bytes
+ */
+inline void UploadUniform(GLint location, GLenum type, GLsizei count, const void* data)
+{
+    const GLfloat* f = static_cast<const GLfloat*>(data);
+    const GLint* i = static_cast<const GLint*>(data);
+    const GLuint* u = static_cast<const GLuint*>(data);
+
+    switch (type)
+    {
+        case GL_FLOAT:             glUniform1fv(location, count, f); break;
+        case GL_FLOAT_VEC2:        glUniform2fv(location, count, f); break;
+        case GL_FLOAT_VEC3:        glUniform3fv(location, count, f); break;
+        case GL_FLOAT_VEC4:        glUniform4fv(location, count, f); break;
+        case GL_INT:
+        case GL_BOOL:              glUniform1iv(location, count, i); break;
+        case GL_INT_VEC2:
+        case GL_BOOL_VEC2:         glUniform2iv(location, count, i); break;
+        case GL_INT_VEC3:
+        case GL_BOOL_VEC3:         glUniform3iv(location, count, i); break;
+        case GL_INT_VEC4:
+        case GL_BOOL_VEC4:         glUniform4iv(location, count, i); break;
+        case GL_UNSIGNED_INT:      glUniform1uiv(location, count, u); break;
+        case GL_UNSIGNED_INT_VEC2: glUniform2uiv(location, count, u); break;
+        case GL_UNSIGNED_INT_VEC3: glUniform3uiv(location, count, u); break;
+        case GL_UNSIGNED_INT_VEC4: glUniform4uiv(location, count, u); break;
+        case GL_FLOAT_MAT2:        glUniformMatrix2fv(location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3:        glUniformMatrix3fv(location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4:        glUniformMatrix4fv(location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT2x3:      glUniformMatrix2x3fv(location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3x2:      glUniformMatrix3x2fv(location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT2x4:      glUniformMatrix2x4fv(location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4x2:      glUniformMatrix4x2fv(location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3x4:      glUniformMatrix3x4fv(location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4x3:      glUniformMatrix4x3fv(location, count, GL_FALSE, f); break;
+#ifdef GL_VERSION_4_0
+        case GL_DOUBLE:            glUniform1dv(location, count, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_VEC2:       glUniform2dv(location, count, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_VEC3:       glUniform3dv(location, count, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_VEC4:       glUniform4dv(location, count, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT2:       glUniformMatrix2dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT3:       glUniformMatrix3dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT4:       glUniformMatrix4dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT2x3:     glUniformMatrix2x3dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT3x2:     glUniformMatrix3x2dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT2x4:     glUniformMatrix2x4dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT4x2:     glUniformMatrix4x2dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT3x4:     glUniformMatrix3x4dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+        case GL_DOUBLE_MAT4x3:     glUniformMatrix4x3dv(location, count, GL_FALSE, static_cast<const GLdouble*>(data)); break;
+#endif
+        default:                   glUniform1iv(location, count, i); break;
+    }
+}
+
+#ifdef GL_VERSION_4_1
+/**
+ * @brief Uploads uniform data to a program without using it
+ * @see glProgramUniform
+ *
+ * @param program The handle of the program
+ * @param location The location of the uniform
+ * @param type The type as returned by `glGetActiveUniform`
+ * @param count The number of array elements
+ * @param data The data, `count * GetUniformTypeSize(type)` bytes
+ */
+inline void UploadProgramUniform(GLuint program, GLint location, GLenum type, GLsizei count, const void* data)
+{
+    const GLfloat* f = static_cast<const GLfloat*>(data);
+    const GLdouble* d = static_cast<const GLdouble*>(data);
+    const GLint* i = static_cast<const GLint*>(data);
+    const GLuint* u = static_cast<const GLuint*>(data);
+
+    switch (type)
+    {
+        case GL_FLOAT:             glProgramUniform1fv(program, location, count, f); break;
+        case GL_FLOAT_VEC2:        glProgramUniform2fv(program, location, count, f); break;
+        case GL_FLOAT_VEC3:        glProgramUniform3fv(program, location, count, f); break;
+        case GL_FLOAT_VEC4:        glProgramUniform4fv(program, location, count, f); break;
+        case GL_INT:
+        case GL_BOOL:              glProgramUniform1iv(program, location, count, i); break;
+        case GL_INT_VEC2:
+        case GL_BOOL_VEC2:         glProgramUniform2iv(program, location, count, i); break;
+        case GL_INT_VEC3:
+        case GL_BOOL_VEC3:         glProgramUniform3iv(program, location, count, i); break;
+        case GL_INT_VEC4:
+        case GL_BOOL_VEC4:         glProgramUniform4iv(program, location, count, i); break;
+        case GL_UNSIGNED_INT:      glProgramUniform1uiv(program, location, count, u); break;
+        case GL_UNSIGNED_INT_VEC2: glProgramUniform2uiv(program, location, count, u); break;
+        case GL_UNSIGNED_INT_VEC3: glProgramUniform3uiv(program, location, count, u); break;
+        case GL_UNSIGNED_INT_VEC4: glProgramUniform4uiv(program, location, count, u); break;
+        case GL_FLOAT_MAT2:        glProgramUniformMatrix2fv(program, location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3:        glProgramUniformMatrix3fv(program, location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4:        glProgramUniformMatrix4fv(program, location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT2x3:      glProgramUniformMatrix2x3fv(program, location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3x2:      glProgramUniformMatrix3x2fv(program, location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT2x4:      glProgramUniformMatrix2x4fv(program, location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4x2:      glProgramUniformMatrix4x2fv(program, location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT3x4:      glProgramUniformMatrix3x4fv(program, location, count, GL_FALSE, f); break;
+        case GL_FLOAT_MAT4x3:      glProgramUniformMatrix4x3fv(program, location, count, GL_FALSE, f); break;
+        case GL_DOUBLE:            glProgramUniform1dv(program, location, count, d); break;
+        case GL_DOUBLE_VEC2:       glProgramUniform2dv(program, location, count, d); break;
+        case GL_DOUBLE_VEC3:       glProgramUniform3dv(program, location, count, d); break;
+        case GL_DOUBLE_VEC4:       glProgramUniform4dv(program, location, count, d); break;
+        case GL_DOUBLE_MAT2:       glProgramUniformMatrix2dv(program, location, count, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT3:       glProgramUniformMatrix3dv(program, location, count, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT4:       glProgramUniformMatrix4dv(program, location, count, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT2x3:     glProgramUniformMatrix2x3dv(program, location, count, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT3x2:     glProgramUniformMatrix3x2dv(program, location, count, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT2x4:     glProgramUniformMatrix2x4dv(program, location, count, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT4x2:     glProgramUniformMatrix4x2dv(program, location, count, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT3x4:     glProgramUniformMatrix3x4dv(program, location, count, GL_FALSE, d); break;
+        case GL_DOUBLE_MAT4x3:     glProgramUniformMatrix4x3dv(program, location, count, GL_FALSE, d); break;
+        default:                   glProgramUniform1iv(program, location, count, i); break;
+    }
+}
+#endif
+
+/// @brief Counters kept by the uniform shadow of a `ShaderManager`
+struct UniformStats
+{
+    /// @brief The number of uniform uploads forwarded to GL
+    uint64_t uploaded = 0;
+    /// @brief The number of uniform uploads skipped because the value was unchanged
+    uint64_t skipped = 0;
+};
+
+/**
+ * @brief An open-addressing hash table from name hashes to uniform indices
+ *
+ * Hashes are expected to be well distributed, e.g. from `Hash`, so they are
+ * used as-is for probing.
+ */
+class UniformTable
+{
+  protected:
+    struct Bucket
+    {
+        uint64_t hash = 0;
+        int32_t index = -1;
+    };
+
+    std::vector<Bucket> m_buckets;
+    size_t m_count = 0;
+
+  public:
+    /// @brief Removes all entries
+    void Clear()
+    {
+        m_buckets.clear();
+        m_count = 0;
+    }
+
+    /**
+     * @brief Inserts an entry, keeping the load factor at or below one half
+     *
+     * @return Whether the entry was inserted, false if the hash is already present
+     */
+    bool Insert(uint64_t hash, int32_t index)
+    {
+        if ((m_count + 1) * 2 > m_buckets.size()) Grow();
+        if (!Place(m_buckets, hash, index)) return false;
+        m_count++;
+        return true;
+    }
+
+    /// @brief Finds the index stored for a hash, or -1
+    int32_t Find(uint64_t hash) const
+    {
+        if (m_buckets.empty()) return -1;
+
+        size_t mask = m_buckets.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            const Bucket& bucket = m_buckets[i];
+            if (bucket.index < 0) return -1;
+            if (bucket.hash == hash) return bucket.index;
+        }
+    }
+
+  protected:
+    static bool Place(std::vector<Bucket>& buckets, uint64_t hash, int32_t index)
+    {
+        size_t mask = buckets.size() - 1;
+        for (size_t i = hash & mask;; i = (i + 1) & mask)
+        {
+            Bucket& bucket = buckets[i];
+            if (bucket.index >= 0)
+            {
+                if (bucket.hash == hash) return false;
+                continue;
+            }
+
+            bucket.hash = hash;
+            bucket.index = index;
+            return true;
+        }
+    }
+
+    void Grow()
+    {
+        std::vector<Bucket> buckets(m_buckets.empty() ? 16 : m_buckets.size() * 2);
+        for (const Bucket& bucket : m_buckets)
+            if (bucket.index >= 0) Place(buckets, bucket.hash, bucket.index);
+        m_buckets.swap(buckets);
+    }
+};
+
+} // namespace glwrap
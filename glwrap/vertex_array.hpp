@@ -1,34 +1,122 @@
 #pragma once
 
+#include <cstddef>
+
 #include "glwrap/include_gl.h"
 
 #ifndef GL_VERSION_3_0
 #error "OpenGL 3.0 is required to use VertexArray"
 #endif
 
+#include "glwrap/buffer.hpp"
+#include "glwrap/features.hpp"
 #include "glwrap/object.hpp"
 
 namespace glwrap
 {
 
+/**
+ * @brief Gets the size in bytes of a GL data type, or 0 if unknown
+ *
+ * @note A value of a packed type holds all components, see `GetAttributeSize`
+ */
+constexpr GLsizei GetTypeSize(GLenum type)
+{
+    switch (type)
+    {
+        case GL_BYTE:
+        case GL_UNSIGNED_BYTE:  return 1;
+        case GL_SHORT:
+        case GL_UNSIGNED_SHORT:
+        case GL_HALF_FLOAT:     return 2;
+        case GL_INT:
+        case GL_UNSIGNED_INT:
+        case GL_FLOAT:          return 4;
+        case GL_DOUBLE:         return 8;
+#ifdef GL_VERSION_3_3
+        case GL_INT_2_10_10_10_REV:
+#endif
+        case GL_UNSIGNED_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_10F_11F_11F_REV: return 4;
+        default:                return 0;
+    }
+}
+
+/**
+ * @brief Gets the size in bytes of a vertex attribute, or 0 if the type is unknown
+ *
+ * @param components The number of components, or `GL_BGRA`
+ * @param type The data type of each component
+ */
+constexpr GLsizei GetAttributeSize(GLint components, GLenum type)
+{
+    switch (type)
+    {
+#ifdef GL_VERSION_3_3
+        case GL_INT_2_10_10_10_REV:
+#endif
+        case GL_UNSIGNED_INT_2_10_10_10_REV:
+        case GL_UNSIGNED_INT_10F_11F_11F_REV: return 4;
+        default: return (components == GL_BGRA ? 4 : components) * GetTypeSize(type);
+    }
+}
+
 /**
  * @brief A vertex array object
  */
 class VertexArray : public Object<GL_VERTEX_ARRAY_BINDING>
 {
+  protected:
+    bool m_direct = false;
+
   public:
-    VertexArray() { glGenVertexArrays(1, &m_handle); }
-    ~VertexArray() { glDeleteVertexArrays(1, &m_handle); }
+    VertexArray()
+    {
+#ifdef GLWRAP_DSA
+        if (Features::DirectStateAccess())
+        {
+            glCreateVertexArrays(1, &m_handle);
+            m_direct = true;
+            return;
+        }
+#endif
+        glGenVertexArrays(1, &m_handle);
+    }
+    ~VertexArray()
+    {
+        Forget(m_handle);
+        glDeleteVertexArrays(1, &m_handle);
+    }
 
     VertexArray(const VertexArray& other) = delete;
     VertexArray& operator=(const VertexArray& other) = delete;
     VertexArray(VertexArray&& other) = delete;
 
-    void Bind() const { glBindVertexArray(m_handle); }
-    void Unbind() const { glBindVertexArray(0); }
+    /**
+     * @brief Returns whether the vertex array was created with `glCreateVertexArrays` and is edited with
+     * direct state access, decided once when it is created
+     */
+    inline bool IsDirect() const { return m_direct; }
+
+
+    /// @note Binding is skipped if the vertex array is already bound
+    void Bind() const
+    {
+        if (!Track(m_handle)) return;
+        glBindVertexArray(m_handle);
+
+        // the element array buffer binding is part of the vertex array's state
+        Object<GL_ELEMENT_ARRAY_BUFFER_BINDING>::Invalidate();
+    }
+    void Unbind() const
+    {
+        if (!Track(0)) return;
+        glBindVertexArray(0);
+        Object<GL_ELEMENT_ARRAY_BUFFER_BINDING>::Invalidate();
+    }
 
     /**
-     * @brief Defines a vertex attribute
+     * @brief Defines a vertex attribute read as floats, integer data is converted
      * @see glVertexAttribPointer
      *
      * @param index The index of the attribute
@@ -38,19 +126,244 @@ class VertexArray : public Object<GL_VERTEX_ARRAY_BINDING>
      * @param stride The byte offset between consecutive attributes
      * @param offset The byte offset of the first component
      *
-     * @note This function binds the buffer
+     * @note The attribute sources the currently bound `ArrayBuffer`
+     * @note The attribute is also enabled
+     * @note This function binds the vertex array unless direct state access is used
      */
     void DefineAttribute(
         GLuint index, GLint components, GLenum type,
         GLboolean normalized, GLsizei stride, size_t offset
     )
     {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            // a tightly packed stride is implicit for glVertexAttribPointer only
+            if (stride == 0) stride = GetAttributeSize(components, type);
+
+            // like glVertexAttribPointer, use the attribute index as binding index
+            GLuint buffer = Object<GL_ARRAY_BUFFER_BINDING>::GetBound();
+            glVertexArrayVertexBuffer(m_handle, index, buffer, static_cast<GLintptr>(offset), stride);
+            glVertexArrayAttribFormat(m_handle, index, components, type, normalized, 0);
+            glVertexArrayAttribBinding(m_handle, index, index);
+            glEnableVertexArrayAttrib(m_handle, index);
+            return;
+        }
+#endif
         Bind();
         glVertexAttribPointer(
             index, components, type,
             normalized, stride, reinterpret_cast<void*>(offset)
         );
+        glEnableVertexAttribArray(index);
+    }
+
+    /**
+     * @brief Defines a vertex attribute read as integers, e.g. an `ivec4` or `uint` input
+     * @see glVertexAttribIPointer
+     *
+     * @param index The index of the attribute
+     * @param components The number of components per vertex
+     * @param type The OpenGL integer data type of each component
+     * @param stride The byte offset between consecutive attributes
+     * @param offset The byte offset of the first component
+     *
+     * @note The attribute sources the currently bound `ArrayBuffer`
+     * @note The attribute is also enabled
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void DefineIntegerAttribute(GLuint index, GLint components, GLenum type, GLsizei stride, size_t offset)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            if (stride == 0) stride = GetAttributeSize(components, type);
+
+            GLuint buffer = Object<GL_ARRAY_BUFFER_BINDING>::GetBound();
+            glVertexArrayVertexBuffer(m_handle, index, buffer, static_cast<GLintptr>(offset), stride);
+            glVertexArrayAttribIFormat(m_handle, index, components, type, 0);
+            glVertexArrayAttribBinding(m_handle, index, index);
+            glEnableVertexArrayAttrib(m_handle, index);
+            return;
+        }
+#endif
+        Bind();
+        glVertexAttribIPointer(index, components, type, stride, reinterpret_cast<void*>(offset));
+        glEnableVertexAttribArray(index);
     }
+
+    /**
+     * @brief Enables a vertex attribute
+     * @see glEnableVertexAttribArray
+     *
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void EnableAttribute(GLuint index)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glEnableVertexArrayAttrib(m_handle, index);
+            return;
+        }
+#endif
+        Bind();
+        glEnableVertexAttribArray(index);
+    }
+
+    /**
+     * @brief Disables a vertex attribute
+     * @see glDisableVertexAttribArray
+     *
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void DisableAttribute(GLuint index)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glDisableVertexArrayAttrib(m_handle, index);
+            return;
+        }
+#endif
+        Bind();
+        glDisableVertexAttribArray(index);
+    }
+
+    /**
+     * @brief Sets the element array buffer
+     * @see glVertexArrayElementBuffer
+     *
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void BindElementBuffer(const ElementArrayBuffer& buffer)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glVertexArrayElementBuffer(m_handle, buffer.Handle());
+
+            // the cached element buffer binding belongs to the bound vertex array
+            if (IsBound()) Object<GL_ELEMENT_ARRAY_BUFFER_BINDING>::Invalidate();
+            return;
+        }
+#endif
+        Bind();
+        buffer.Bind();
+    }
+
+#ifdef GL_VERSION_4_3
+    /**
+     * @brief Sets the format of a vertex attribute read as floats, independently of its buffer
+     * @see glVertexAttribFormat
+     *
+     * @param index The index of the attribute
+     * @param components The number of components per vertex
+     * @param type The OpenGL data type of each component
+     * @param normalized Whether the data should be normalized
+     * @param offset The byte offset of the attribute within a vertex
+     *
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void AttributeFormat(GLuint index, GLint components, GLenum type, GLboolean normalized, GLuint offset)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glVertexArrayAttribFormat(m_handle, index, components, type, normalized, offset);
+            return;
+        }
+#endif
+        Bind();
+        glVertexAttribFormat(index, components, type, normalized, offset);
+    }
+
+    /**
+     * @brief Sets the format of a vertex attribute read as integers, independently of its buffer
+     * @see glVertexAttribIFormat
+     *
+     * @param index The index of the attribute
+     * @param components The number of components per vertex
+     * @param type The OpenGL integer data type of each component
+     * @param offset The byte offset of the attribute within a vertex
+     *
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void IntegerAttributeFormat(GLuint index, GLint components, GLenum type, GLuint offset)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glVertexArrayAttribIFormat(m_handle, index, components, type, offset);
+            return;
+        }
+#endif
+        Bind();
+        glVertexAttribIFormat(index, components, type, offset);
+    }
+
+    /**
+     * @brief Sets the vertex buffer binding a vertex attribute sources
+     * @see glVertexAttribBinding
+     *
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void AttributeBinding(GLuint index, GLuint binding)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glVertexArrayAttribBinding(m_handle, index, binding);
+            return;
+        }
+#endif
+        Bind();
+        glVertexAttribBinding(index, binding);
+    }
+
+    /**
+     * @brief Binds a vertex buffer to a binding, for all attributes sourcing it
+     * @see glBindVertexBuffer
+     *
+     * @param binding The index of the vertex buffer binding
+     * @param buffer The vertex buffer
+     * @param offset The byte offset of the first vertex in the buffer
+     * @param stride The byte offset between consecutive vertices
+     *
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void BindVertexBuffer(GLuint binding, const ArrayBuffer& buffer, GLintptr offset, GLsizei stride)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glVertexArrayVertexBuffer(m_handle, binding, buffer.Handle(), offset, stride);
+            return;
+        }
+#endif
+        Bind();
+        glBindVertexBuffer(binding, buffer.Handle(), offset, stride);
+    }
+
+    /**
+     * @brief Sets the number of instances per vertex of a binding, 0 for per-vertex data
+     * @see glVertexBindingDivisor
+     *
+     * @note This function binds the vertex array unless direct state access is used
+     */
+    void BindingDivisor(GLuint binding, GLuint divisor)
+    {
+#ifdef GLWRAP_DSA
+        if (m_direct)
+        {
+            glVertexArrayBindingDivisor(m_handle, binding, divisor);
+            return;
+        }
+#endif
+        Bind();
+        glVertexBindingDivisor(binding, divisor);
+    }
+#endif
 };
 
 } // namespace glwrap
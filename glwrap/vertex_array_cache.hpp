@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+#include "glwrap/include_gl.h"
+#include "glwrap/buffer.hpp"
+#include "glwrap/hash.hpp"
+#include "glwrap/vertex_array.hpp"
+#include "glwrap/vertex_layout.hpp"
+
+namespace glwrap
+{
+
+/// @brief Statistics of a vertex array cache
+struct VertexArrayCacheStats
+{
+    /// @brief The number of vertex arrays returned from the cache
+    uint64_t hits;
+    /// @brief The number of vertex arrays created
+    uint64_t misses;
+    /// @brief The number of least recently used vertex arrays deleted to make room
+    uint64_t evictions;
+};
+
+/**
+ * @brief Shares vertex arrays between meshes with the same layout and buffers
+ *
+ * Vertex arrays are keyed on the layout's hash and the handles of the vertex
+ * and element buffers. Once the cache is full, the least recently used
+ * vertex array is deleted.
+ *
+ * @note A returned vertex array stays valid until it is evicted, i.e. at
+ * least until the next `Get`
+ */
+class VertexArrayCache
+{
+  protected:
+    struct Entry
+    {
+        uint64_t key;
+        uint64_t layout;
+        GLuint vertexBuffer;
+        GLuint elementBuffer;
+        std::unique_ptr<VertexArray> vao;
+    };
+
+    size_t m_capacity;
+    std::list<Entry> m_entries = {};
+    // chained, as different layouts and buffers may have the same key
+    std::unordered_multimap<uint64_t, std::list<Entry>::iterator> m_lookup = {};
+    VertexArrayCacheStats m_stats = {};
+
+  public:
+    /// @param capacity The maximum number of vertex arrays kept
+    explicit VertexArrayCache(size_t capacity = 64)
+        : m_capacity(capacity > 0 ? capacity : 1) { }
+
+    VertexArrayCache(const VertexArrayCache& other) = delete;
+    VertexArrayCache& operator=(const VertexArrayCache& other) = delete;
+    VertexArrayCache(VertexArrayCache&& other) = delete;
+
+    inline size_t Size() const { return m_entries.size(); }
+    inline size_t Capacity() const { return m_capacity; }
+    inline const VertexArrayCacheStats& Stats() const { return m_stats; }
+    inline void ResetStats() { m_stats = {}; }
+
+    /**
+     * @brief Gets the vertex array for a layout and buffers, creating it on a miss
+     *
+     * @tparam _layout The `VertexLayout` of the vertex buffer
+     * @param vertexBuffer The vertex buffer
+     * @param elementBuffer The element buffer, or `nullptr` for none
+     */
+    template <typename _layout>
+    VertexArray& Get(const ArrayBuffer& vertexBuffer, const ElementArrayBuffer* elementBuffer = nullptr)
+    {
+        GLuint elements = elementBuffer ? elementBuffer->Handle() : 0;
+        uint64_t key = HashCombine(HashCombine(_layout::HASH, vertexBuffer.Handle()), elements);
+
+        auto [begin, end] = m_lookup.equal_range(key);
+        for (auto it = begin; it != end; ++it)
+        {
+            const Entry& entry = *it->second;
+            if (entry.layout != _layout::HASH || entry.vertexBuffer != vertexBuffer.Handle()
+                || entry.elementBuffer != elements) continue;
+
+            m_stats.hits++;
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            return *it->second->vao;
+        }
+        m_stats.misses++;
+
+        if (m_entries.size() >= m_capacity)
+        {
+            Unlink(std::prev(m_entries.end()));
+            m_entries.pop_back();
+            m_stats.evictions++;
+        }
+
+        auto vao = std::make_unique<VertexArray>();
+#ifdef GL_VERSION_4_3
+        _layout::Apply(*vao);
+        _layout::BindVertexBuffer(*vao, vertexBuffer);
+#else
+        vertexBuffer.Bind();
+        _layout::Define(*vao);
+#endif
+        if (elementBuffer) vao->BindElementBuffer(*elementBuffer);
+
+        m_entries.push_front({key, _layout::HASH, vertexBuffer.Handle(), elements, std::move(vao)});
+        m_lookup.emplace(key, m_entries.begin());
+        return *m_entries.front().vao;
+    }
+
+    /**
+     * @brief Deletes the vertex arrays using a buffer, call this before deleting the buffer
+     *
+     * @param buffer The handle of a vertex or element buffer
+     */
+    void Remove(GLuint buffer)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            if (it->vertexBuffer != buffer && it->elementBuffer != buffer)
+            {
+                ++it;
+                continue;
+            }
+
+            Unlink(it);
+            it = m_entries.erase(it);
+        }
+    }
+
+    /// @brief Deletes all vertex arrays
+    void Clear()
+    {
+        m_lookup.clear();
+        m_entries.clear();
+    }
+
+  protected:
+    /// @brief Removes an entry from the lookup, leaving it in the list
+    void Unlink(std::list<Entry>::iterator entry)
+    {
+        auto [begin, end] = m_lookup.equal_range(entry->key);
+        for (auto it = begin; it != end; ++it)
+        {
+            if (it->second != entry) continue;
+
+            m_lookup.erase(it);
+            return;
+        }
+    }
+};
+
+} // namespace glwrap
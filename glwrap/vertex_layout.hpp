@@ -0,0 +1,204 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "glwrap/include_gl.h"
+#include "glwrap/hash.hpp"
+#include "glwrap/vertex_array.hpp"
+
+namespace glwrap
+{
+
+/// @brief The components and data type of a vertex attribute type, e.g. `std::array<GLfloat, 3>`
+template <typename T>
+struct VertexFormat;
+
+template <GLenum _type, GLint _components>
+struct VertexFormatOf
+{
+    static constexpr GLenum TYPE = _type;
+    static constexpr GLint COMPONENTS = _components;
+};
+
+template <> struct VertexFormat<GLfloat> : VertexFormatOf<GL_FLOAT, 1> { };
+template <> struct VertexFormat<GLint> : VertexFormatOf<GL_INT, 1> { };
+template <> struct VertexFormat<GLuint> : VertexFormatOf<GL_UNSIGNED_INT, 1> { };
+template <> struct VertexFormat<GLshort> : VertexFormatOf<GL_SHORT, 1> { };
+template <> struct VertexFormat<GLushort> : VertexFormatOf<GL_UNSIGNED_SHORT, 1> { };
+template <> struct VertexFormat<GLbyte> : VertexFormatOf<GL_BYTE, 1> { };
+template <> struct VertexFormat<GLubyte> : VertexFormatOf<GL_UNSIGNED_BYTE, 1> { };
+
+template <typename T, size_t N>
+struct VertexFormat<std::array<T, N>> : VertexFormatOf<VertexFormat<T>::TYPE, static_cast<GLint>(N)>
+{
+    static_assert(N >= 1 && N <= 4, "Vertex attributes have 1 to 4 components");
+};
+
+/**
+ * @brief A vertex attribute of a `VertexLayout`
+ *
+ * Integer data is converted to floats unless `_integer` is set, see `IntegerAttribute`.
+ *
+ * @tparam T The attribute's type, e.g. `std::array<GLfloat, 3>`
+ * @tparam _index The attribute index, as in `layout(location = index)`
+ * @tparam _normalized Whether integer data is normalized when converted
+ * @tparam _integer Whether integer data is read as integers, for `int`, `uint` and `ivec` inputs
+ */
+template <typename T, GLuint _index, GLboolean _normalized = GL_FALSE, bool _integer = false>
+struct Attribute
+{
+    using Type = T;
+
+    static constexpr GLuint INDEX = _index;
+    static constexpr GLenum TYPE = VertexFormat<T>::TYPE;
+    static constexpr GLint COMPONENTS = VertexFormat<T>::COMPONENTS;
+    static constexpr GLboolean NORMALIZED = _normalized;
+    static constexpr bool INTEGER = _integer;
+    static constexpr GLsizei SIZE = GetAttributeSize(COMPONENTS, TYPE);
+
+    static_assert(!INTEGER || TYPE != GL_FLOAT, "Integer attributes need an integer type");
+    static_assert(!INTEGER || !NORMALIZED, "Integer attributes are not normalized");
+};
+
+/// @brief A vertex attribute read as integers, e.g. `IntegerAttribute<std::array<GLint, 4>, 5>` for an `ivec4`
+template <typename T, GLuint _index>
+using IntegerAttribute = Attribute<T, _index, GL_FALSE, true>;
+
+/// @brief A position attribute at index 0
+template <typename T> using Position = Attribute<T, 0>;
+/// @brief A normal attribute at index 1
+template <typename T> using Normal = Attribute<T, 1>;
+/// @brief A texture coordinate attribute at index 2
+template <typename T> using UV = Attribute<T, 2>;
+/// @brief A color attribute at index 3, normalized if integer
+template <typename T> using Color = Attribute<T, 3, GL_TRUE>;
+/// @brief A tangent attribute at index 4
+template <typename T> using Tangent = Attribute<T, 4>;
+
+/**
+ * @brief An interleaved vertex layout, computed at compile time
+ *
+ * Attributes are tightly packed in order, e.g.
+ * `VertexLayout<Position<std::array<GLfloat, 3>>, UV<std::array<GLfloat, 2>>>`
+ * has a stride of 20 bytes with the UV at offset 12.
+ */
+template <typename... _attributes>
+struct VertexLayout
+{
+    static_assert(sizeof...(_attributes) > 0, "A vertex layout needs at least one attribute");
+
+    static constexpr size_t COUNT = sizeof...(_attributes);
+
+    /// @brief The byte offset between consecutive vertices
+    static constexpr GLsizei STRIDE = (_attributes::SIZE + ...);
+
+    /// @brief The attribute indices, in order
+    static constexpr std::array<GLuint, COUNT> INDICES = {_attributes::INDEX...};
+
+    /// @brief The byte offsets of the attributes within a vertex, in order
+    static constexpr std::array<GLuint, COUNT> OFFSETS = []
+    {
+        std::array<GLsizei, COUNT> sizes = {_attributes::SIZE...};
+        std::array<GLuint, COUNT> offsets = {};
+        for (size_t i = 1; i < COUNT; i++) offsets[i] = offsets[i - 1] + sizes[i - 1];
+        return offsets;
+    }();
+
+    /// @brief A hash of the layout, equal for layouts with the same attributes
+    static constexpr uint64_t HASH = []
+    {
+        uint64_t hash = HASH_SEED;
+        size_t i = 0;
+        ((hash = HashCombine(hash, HashCombine(
+            (static_cast<uint64_t>(_attributes::INDEX) << 32) | _attributes::TYPE,
+            (static_cast<uint64_t>(_attributes::COMPONENTS) << 32) | (static_cast<uint64_t>(_attributes::INTEGER) << 24)
+                | (_attributes::NORMALIZED << 16) | OFFSETS[i++]
+        ))), ...);
+        return HashCombine(hash, STRIDE);
+    }();
+
+    /**
+     * @brief Returns the byte offset of an attribute within a vertex
+     *
+     * @return The offset, or `STRIDE` if the layout has no attribute at the index
+     */
+    static constexpr GLuint OffsetOf(GLuint index)
+    {
+        for (size_t i = 0; i < COUNT; i++)
+            if (INDICES[i] == index) return OFFSETS[i];
+        return STRIDE;
+    }
+
+    /**
+     * @brief Defines and enables the attributes, sourcing the bound `ArrayBuffer`
+     * @see VertexArray::DefineAttribute
+     *
+     * @param vao The vertex array
+     * @param offset The byte offset of the first vertex in the buffer
+     */
+    static void Define(VertexArray& vao, size_t offset = 0)
+    {
+        size_t i = 0;
+        (DefineAttribute<_attributes>(vao, offset + OFFSETS[i++]), ...);
+    }
+
+#ifdef GL_VERSION_4_3
+    /**
+     * @brief Sets and enables the attributes' formats, sourcing a vertex buffer binding
+     * @see VertexArray::AttributeFormat
+     *
+     * Vertex buffers are then swapped with a single `BindVertexBuffer` call.
+     *
+     * @param vao The vertex array
+     * @param binding The index of the vertex buffer binding
+     */
+    static void Apply(VertexArray& vao, GLuint binding = 0)
+    {
+        size_t i = 0;
+        ((
+            AttributeFormat<_attributes>(vao, OFFSETS[i++]),
+            vao.AttributeBinding(_attributes::INDEX, binding),
+            vao.EnableAttribute(_attributes::INDEX)
+        ), ...);
+    }
+
+    /**
+     * @brief Binds a vertex buffer holding vertices of this layout
+     * @see VertexArray::BindVertexBuffer
+     *
+     * @param vao The vertex array, set up with `Apply`
+     * @param buffer The vertex buffer
+     * @param first The index of the first vertex in the buffer
+     * @param binding The index of the vertex buffer binding
+     */
+    static void BindVertexBuffer(VertexArray& vao, const ArrayBuffer& buffer, GLintptr first = 0, GLuint binding = 0)
+    {
+        vao.BindVertexBuffer(binding, buffer, first * STRIDE, STRIDE);
+    }
+#endif
+
+  protected:
+    template <typename A>
+    static void DefineAttribute(VertexArray& vao, size_t offset)
+    {
+        if constexpr (A::INTEGER)
+            vao.DefineIntegerAttribute(A::INDEX, A::COMPONENTS, A::TYPE, STRIDE, offset);
+        else
+            vao.DefineAttribute(A::INDEX, A::COMPONENTS, A::TYPE, A::NORMALIZED, STRIDE, offset);
+    }
+
+#ifdef GL_VERSION_4_3
+    template <typename A>
+    static void AttributeFormat(VertexArray& vao, GLuint offset)
+    {
+        if constexpr (A::INTEGER)
+            vao.IntegerAttributeFormat(A::INDEX, A::COMPONENTS, A::TYPE, offset);
+        else
+            vao.AttributeFormat(A::INDEX, A::COMPONENTS, A::TYPE, A::NORMALIZED, offset);
+    }
+#endif
+};
+
+} // namespace glwrap
@@ -25,6 +25,26 @@ TEST(SUITE, Bind)
     EXPECT_EQ(ArrayBuffer::GetBound(), 0);
 }
 
+TEST(SUITE, BindCache)
+{
+    ArrayBuffer vbo;
+
+    BindingCache::ResetStats();
+    vbo.Bind();
+    vbo.Bind();
+    EXPECT_EQ(BindingCache::Stats().issued, 1);
+    EXPECT_EQ(BindingCache::Stats().skipped, 1);
+
+    BindingCache::Invalidate();
+    EXPECT_EQ(ArrayBuffer::GetBound(), vbo.Handle());
+    EXPECT_EQ(BindingCache::Stats().queried, 1);
+    EXPECT_TRUE(vbo.IsBound());
+    EXPECT_EQ(BindingCache::Stats().queried, 1);
+
+    vbo.Unbind();
+    EXPECT_EQ(BindingCache::Stats().issued, 2);
+}
+
 TEST(SUITE, Size)
 {
     ArrayBuffer vbo;
@@ -43,17 +63,66 @@ TEST(SUITE, Data)
     float data[4] = {1.0f, 2.0f, 3.0f, 4.0f};
     vbo.Store(4 * sizeof(float), GL_STATIC_DRAW, data);
 
-    float* stored = (float*)vbo.Get();
+    std::unique_ptr<float[]> stored = vbo.GetElements<float>();
     for (int i = 0; i < 4; ++i)
         EXPECT_EQ(data[i], stored[i]);
-    delete stored;
 
     float subData[2] = {5.0f, 6.0f};
     vbo.Write(1 * sizeof(float), subData, 2 * sizeof(float));
 
-    float* subStored = (float*)vbo.Get(1 * sizeof(float), 2 * sizeof(float));
+    std::unique_ptr<float[]> subStored = vbo.GetElements<float>(1, 2);
     for (int i = 0; i < 2; ++i)
         EXPECT_EQ(subData[i], subStored[i]);
+}
+
+TEST(SUITE, GetInto)
+{
+    ArrayBuffer vbo;
+
+    float data[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    vbo.Store(4 * sizeof(float), GL_STATIC_DRAW, data);
+
+    float stored[2];
+    vbo.Get(2 * sizeof(float), 2 * sizeof(float), stored);
+    EXPECT_EQ(stored[0], 3.0f);
+    EXPECT_EQ(stored[1], 4.0f);
+
+    std::vector<float> vector;
+    vbo.GetElements(0, 4, vector);
+    ASSERT_EQ(vector.size(), 4);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_EQ(data[i], vector[i]);
+
+    vbo.GetElements(1, 1, vector);
+    ASSERT_EQ(vector.size(), 1);
+    EXPECT_EQ(vector[0], 2.0f);
+}
+
+TEST(SUITE, DirectStateAccess)
+{
+    if (!Features::DirectStateAccess()) GTEST_SKIP();
+
+    ArrayBuffer vbo;
+    vbo.Unbind();
 
-    delete subStored;
-}
\ No newline at end of file
+    float data[2] = {1.0f, 2.0f};
+    vbo.Store(2 * sizeof(float), GL_STATIC_DRAW, data);
+    EXPECT_EQ(vbo.Size(), 2 * sizeof(float));
+    EXPECT_FALSE(vbo.IsBound());
+
+    // objects keep the path they were created with, also across invalidation
+    Features::SetDirectStateAccess(false);
+    BindingCache::Invalidate();
+    EXPECT_FALSE(Features::DirectStateAccess());
+
+    ArrayBuffer edited;
+    EXPECT_TRUE(vbo.IsDirect());
+    EXPECT_FALSE(edited.IsDirect());
+    Features::ResetDirectStateAccess();
+
+    vbo.Store(4 * sizeof(float), GL_STATIC_DRAW, nullptr);
+    edited.Store(2 * sizeof(float), GL_STATIC_DRAW, data);
+    EXPECT_EQ(vbo.Size(), 4 * sizeof(float));
+    EXPECT_EQ(edited.Size(), 2 * sizeof(float));
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <glwrap/include_gl.h>
+
+#ifdef GL_VERSION_3_2
+#include <thread>
+#include <glwrap/command_buffer.hpp>
+
+using namespace glwrap;
+
+#define SUITE CommandBuffer
+
+TEST(SUITE, Sort)
+{
+    static_assert(MakeSortKey(1, 0, 0, 0) > MakeSortKey(0, 0xffff, 0xffff, 0xffff));
+
+    ShaderManager first, second;
+    for (ShaderManager* manager : {&first, &second})
+    {
+        VertexShader vertexShader;
+        FragmentShader fragmentShader;
+        vertexShader.Source(
+            "#version 330 core\n"
+            "layout(location = 0) in vec2 position;\n"
+            "void main() { gl_Position = vec4(position, 0.0, 1.0); }"
+        );
+        fragmentShader.Source(
+            "#version 330 core\n"
+            "uniform vec4 tint;\n"
+            "out vec4 fragColor;\n"
+            "void main() { fragColor = tint; }"
+        );
+        ASSERT_TRUE(vertexShader.Compile());
+        ASSERT_TRUE(fragmentShader.Compile());
+        manager->Attach(vertexShader);
+        manager->Attach(fragmentShader);
+        ASSERT_TRUE(manager->Link());
+    }
+
+    VertexArray vao;
+    ArrayBuffer vertices;
+    vertices.Initialize(6 * 2 * sizeof(GLfloat), GL_DYNAMIC_DRAW);
+    vertices.Bind();
+    vao.DefineAttribute(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+
+    // record on workers, interleaving the two programs
+    CommandBuffer buffers[2];
+    std::thread workers[2];
+    for (int w = 0; w < 2; w++)
+    {
+        workers[w] = std::thread([&, w]
+        {
+            CommandBuffer& buffer = buffers[w];
+            for (uint16_t i = 0; i < 4; i++)
+            {
+                ShaderManager& manager = i % 2 ? second : first;
+                buffer.Begin(MakeSortKey(i % 2, 0, 0, static_cast<uint16_t>(w * 4 + i)));
+                buffer.Use(manager);
+                buffer.Bind(vao);
+                buffer.SetUniform(manager, "tint"_uniform, std::array<GLfloat, 4>{1.0f, 1.0f, 1.0f, 1.0f});
+                buffer.Draw(GL_TRIANGLES, 0, 3);
+            }
+        });
+    }
+    for (std::thread& worker : workers) worker.join();
+
+    CommandBuffer frame;
+    GLfloat positions[12] = {0, 0, 1, 0, 0, 1};
+    frame.Write(vertices, 0, positions, sizeof(positions));
+    frame.Append(buffers[0]);
+    frame.Append(buffers[1]);
+    EXPECT_EQ(frame.Size(), 9);
+    EXPECT_TRUE(buffers[0].Empty());
+
+    GLuint renderbuffer, framebuffer, query;
+    glGenRenderbuffers(1, &renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 4, 4);
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+    glGenQueries(1, &query);
+
+    first.Unuse();
+    vao.Unbind();
+    first.ResetUniformStats();
+    BindingCache::ResetStats();
+
+    glBeginQuery(GL_PRIMITIVES_GENERATED, query);
+    frame.Submit();
+    glEndQuery(GL_PRIMITIVES_GENERATED);
+
+    // each program is used once and the vertex array bound once
+    EXPECT_EQ(BindingCache::Stats().issued, 3);
+    EXPECT_EQ(first.GetUniformStats().uploaded, 1);
+    EXPECT_EQ(first.GetUniformStats().skipped, 3);
+
+    GLuint primitives = 0;
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT, &primitives);
+    EXPECT_EQ(primitives, 8);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+
+    second.Unuse();
+    vao.Unbind();
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteQueries(1, &query);
+    glDeleteFramebuffers(1, &framebuffer);
+    glDeleteRenderbuffers(1, &renderbuffer);
+}
+
+TEST(SUITE, SelfContainedPackets)
+{
+    ShaderManager manager;
+    VertexArray vao;
+
+    // the second packet would draw with whatever the packet sorted before it left bound
+    CommandBuffer buffer;
+    buffer.Begin(1);
+    buffer.Use(manager);
+    buffer.Bind(vao);
+    buffer.Draw(GL_TRIANGLES, 0, 3);
+    buffer.Begin(0);
+    EXPECT_DEBUG_DEATH(buffer.Draw(GL_TRIANGLES, 0, 3), "before drawing");
+}
+#endif
@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <glwrap/compile_batch.hpp>
+
+using namespace glwrap;
+
+#define SUITE CompileBatch
+
+TEST(SUITE, Finish)
+{
+    CompileBatch::SetMaxThreads(2);
+
+    CompileBatch batch;
+    VertexShader vertexShader;
+    FragmentShader fragmentShader, brokenShader;
+    ShaderManager manager;
+
+    vertexShader.Source(
+        "#version 330 core\n"
+        "void main() { gl_Position = vec4(0.0); }"
+    );
+    fragmentShader.Source(
+        "#version 330 core\n"
+        "uniform vec4 tint;\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = tint; }"
+    );
+    brokenShader.Source("#version 330 core\nvoid main() { undeclared = 1; }");
+
+    manager.Attach(vertexShader);
+    manager.Attach(fragmentShader);
+
+    batch.Add(vertexShader);
+    batch.Add(fragmentShader);
+    batch.Add(brokenShader);
+    batch.Add(manager);
+    EXPECT_EQ(batch.Pending(), 4);
+
+    while (batch.Poll() > 0) { }
+    EXPECT_FALSE(batch.Finish());
+    EXPECT_EQ(batch.Pending(), 0);
+    EXPECT_EQ(batch.Failed(), 1);
+    ASSERT_EQ(batch.Errors().size(), 1);
+    EXPECT_FALSE(batch.Errors()[0].empty());
+
+    EXPECT_TRUE(manager.GetLinkStatus());
+    EXPECT_NE(manager.GetUniformLocation("tint"), -1);
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <glwrap/draw.hpp>
+#include <glwrap/shader.hpp>
+
+using namespace glwrap;
+
+class DrawTest : public ::testing::Test
+{
+  protected:
+    Program program;
+    VertexArray vao;
+    ArrayBuffer vertices;
+    ElementArrayBuffer indices;
+    GLuint framebuffer, renderbuffer, query;
+
+    void SetUp() override
+    {
+        VertexShader vertexShader;
+        FragmentShader fragmentShader;
+        vertexShader.Source(
+            "#version 330 core\n"
+            "layout(location = 0) in vec2 position;\n"
+            "void main() { gl_Position = vec4(position, 0.0, 1.0); }"
+        );
+        fragmentShader.Source(
+            "#version 330 core\n"
+            "out vec4 fragColor;\n"
+            "void main() { fragColor = vec4(1.0); }"
+        );
+        ASSERT_TRUE(vertexShader.Compile());
+        ASSERT_TRUE(fragmentShader.Compile());
+        program.Attach(vertexShader);
+        program.Attach(fragmentShader);
+        ASSERT_TRUE(program.Link());
+        program.Use();
+
+        GLfloat positions[] = {0, 0, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0};
+        GLuint elements[] = {0, 1, 2, 1, 3, 2};
+        vertices.Store(sizeof(positions), GL_STATIC_DRAW, positions);
+        vertices.Bind();
+        vao.DefineAttribute(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        vao.BindElementBuffer(indices);
+        indices.Store(sizeof(elements), GL_STATIC_DRAW, elements);
+
+        // draws need a complete framebuffer even with rasterization discarded
+        glGenRenderbuffers(1, &renderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, 4, 4);
+        glGenFramebuffers(1, &framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+
+        glGenQueries(1, &query);
+        glEnable(GL_RASTERIZER_DISCARD);
+        glBeginQuery(GL_PRIMITIVES_GENERATED, query);
+    }
+
+    void TearDown() override
+    {
+        glDisable(GL_RASTERIZER_DISCARD);
+        glDeleteQueries(1, &query);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteRenderbuffers(1, &renderbuffer);
+        program.Unuse();
+        vao.Unbind();
+    }
+
+    GLuint Primitives()
+    {
+        glEndQuery(GL_PRIMITIVES_GENERATED);
+        GLuint primitives = 0;
+        glGetQueryObjectuiv(query, GL_QUERY_RESULT, &primitives);
+        return primitives;
+    }
+};
+
+TEST_F(DrawTest, Draw)
+{
+    Draw(vao, GL_TRIANGLES, 0, 6);
+    DrawIndexed(vao, GL_TRIANGLES, 6, GL_UNSIGNED_INT);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+    EXPECT_EQ(Primitives(), 4);
+}
+
+#ifdef GL_VERSION_3_2
+TEST_F(DrawTest, Instanced)
+{
+    DrawInstanced(vao, GL_TRIANGLES, 0, 3, 2);
+    DrawIndexedInstanced(vao, GL_TRIANGLES, 3, GL_UNSIGNED_INT, 3 * sizeof(GLuint), 3);
+    DrawElementsBaseVertex(vao, GL_TRIANGLES, 3, GL_UNSIGNED_INT, 0, 2);
+    DrawElementsInstancedBaseVertex(vao, GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, 2, 1);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+    EXPECT_EQ(Primitives(), 10);
+}
+#endif
+
+#ifdef GL_VERSION_4_3
+TEST_F(DrawTest, MultiDrawIndirect)
+{
+    DrawCommandBuilder commands;
+    commands.Add(3, 0);
+    commands.Add(3, 3, 1, 2);
+    commands.Add(6, 0, 0, 3);
+    EXPECT_EQ(commands.ByteSize(), 3 * sizeof(DrawElementsIndirectCommand));
+
+    DrawIndirectBuffer buffer;
+    commands.Submit(vao, buffer, GL_TRIANGLES, GL_UNSIGNED_INT);
+
+    DrawArraysIndirectCommand single = {6, 1, 0, 0};
+    DrawIndirectBuffer arrays;
+    arrays.Store(sizeof(single), GL_STATIC_DRAW, &single);
+    DrawIndirect(vao, GL_TRIANGLES, arrays);
+    MultiDrawArraysIndirect(vao, GL_TRIANGLES, arrays, 0, 1);
+    DrawElementsIndirect(vao, GL_TRIANGLES, GL_UNSIGNED_INT, buffer, sizeof(DrawElementsIndirectCommand));
+
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+    EXPECT_EQ(Primitives(), 1 + 2 + 6 + 2 + 2 + 2);
+}
+#endif
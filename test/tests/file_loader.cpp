@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <glwrap/file_loader.hpp>
+#include <glwrap/shader.hpp>
+
+using namespace glwrap;
+
+#define SUITE FileLoader
+
+TEST(SUITE, Load)
+{
+    auto directory = std::filesystem::temp_directory_path() / "glwrap_file_loader";
+    std::filesystem::create_directories(directory);
+    std::ofstream(directory / "a.vert") <<
+        "#version 330 core\n"
+        "void main() { gl_Position = vec4(0.0); }";
+    std::ofstream(directory / "empty.txt");
+
+    FileLoader loader(2);
+    VertexShader shader;
+    bool compiled = false, empty = false, missing = true;
+
+    loader.Load((directory / "a.vert").string(), [&](FileLoader::Result& result)
+    {
+        ASSERT_TRUE(result);
+        shader.Source({result.View()});
+        compiled = shader.Compile();
+    });
+    loader.Load((directory / "empty.txt").string(), [&](FileLoader::Result& result)
+    {
+        empty = result && result.View().empty();
+    });
+    loader.Load((directory / "missing.txt").string(), [&](FileLoader::Result& result)
+    {
+        missing = !result;
+    });
+
+    EXPECT_EQ(loader.Finish(), 3);
+    EXPECT_EQ(loader.Pending(), 0);
+    EXPECT_EQ(loader.Poll(), 0);
+    EXPECT_TRUE(compiled);
+    EXPECT_TRUE(empty);
+    EXPECT_TRUE(missing);
+
+    std::filesystem::remove_all(directory);
+}
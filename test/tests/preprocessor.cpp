@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <glwrap/preprocessor.hpp>
+
+using namespace glwrap;
+
+#define SUITE Preprocessor
+
+static std::filesystem::path WriteFiles()
+{
+    auto directory = std::filesystem::temp_directory_path() / "glwrap_preprocessor";
+    std::filesystem::create_directories(directory / "include");
+
+    std::ofstream(directory / "include" / "common.glsl") <<
+        "#pragma once\n"
+        "vec4 Tint() { return vec4(TINT); }\n";
+    std::ofstream(directory / "lighting.glsl") <<
+        "#include \"common.glsl\"\n"
+        "vec4 Light() { return Tint(); }\n";
+    std::ofstream(directory / "main.frag") <<
+        "#version 330 core\n"
+        "#include <common.glsl>\n"
+        "#include \"lighting.glsl\"\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = Light(); }\n";
+    std::ofstream(directory / "loop.glsl") << "#include \"loop.glsl\"\n";
+
+    return directory;
+}
+
+TEST(SUITE, Process)
+{
+    auto directory = WriteFiles();
+
+    ShaderPreprocessor preprocessor;
+    preprocessor.AddIncludePath(directory / "include");
+
+    PreprocessedSource result = preprocessor.Process(directory / "main.frag", {{"TINT", "0.5"}});
+    ASSERT_TRUE(result) << result.error;
+    EXPECT_EQ(result.files.size(), 3);
+    EXPECT_EQ(result.source.find("#version 330 core\n#define TINT 0.5\n"), 0);
+
+    // common.glsl is only expanded once
+    EXPECT_EQ(result.source.find("Tint()"), result.source.rfind("vec4 Tint()") + 5);
+    EXPECT_EQ(preprocessor.GetFile(0), result.files[0]);
+
+    // a reloaded file keeps its source string number
+    preprocessor.Invalidate(directory / "lighting.glsl");
+    PreprocessedSource reloaded = preprocessor.Process(directory / "main.frag", {{"TINT", "0.5"}});
+    EXPECT_EQ(reloaded.source, result.source);
+    EXPECT_EQ(preprocessor.GetFile(3), std::filesystem::path());
+
+    FragmentShader shader;
+    shader.Source(result.source.c_str());
+    EXPECT_TRUE(shader.Compile()) << shader.GetInfoLog();
+
+    EXPECT_FALSE(preprocessor.Process(directory / "loop.glsl"));
+    EXPECT_FALSE(preprocessor.Process(directory / "missing.glsl"));
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(SUITE, Variants)
+{
+    auto directory = WriteFiles();
+
+    auto permutations = Permutations({{"TINT", {"0.0", "1.0"}}, {"UNUSED", {"0", "1", "2"}}});
+    EXPECT_EQ(permutations.size(), 6);
+    EXPECT_EQ(VariantKey("a", {{"A", "1"}, {"B", "2"}}), VariantKey("a", {{"B", "2"}, {"A", "1"}}));
+    EXPECT_NE(VariantKey("a", {{"A", "1"}}), VariantKey("a", {{"A", "2"}}));
+
+    ShaderPreprocessor preprocessor;
+    preprocessor.AddIncludePath(directory / "include");
+    ShaderVariants<GL_FRAGMENT_SHADER> variants(preprocessor);
+
+    for (const ShaderDefines& defines : permutations)
+    {
+        FragmentShader* shader = variants.Get(directory / "main.frag", defines);
+        ASSERT_NE(shader, nullptr);
+        EXPECT_TRUE(shader->GetCompileStatus());
+    }
+    EXPECT_EQ(variants.Get(directory / "main.frag", permutations[0]), variants.Get(directory / "main.frag", permutations[0]));
+    EXPECT_EQ(variants.Size(), 6);
+    EXPECT_EQ(variants.Stats().misses, 6);
+    EXPECT_EQ(variants.Stats().hits, 2);
+
+    // a changed include evicts only the variants expanded from it
+    std::ofstream(directory / "plain.frag") <<
+        "#version 330 core\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = vec4(1.0); }\n";
+    FragmentShader* plain = variants.Get(directory / "plain.frag");
+    std::ofstream(directory / "lighting.glsl") << "vec4 Light() { return vec4(0.5); }\n";
+    EXPECT_EQ(variants.Invalidate(directory / "include" / ".." / "lighting.glsl"), 6);
+    EXPECT_EQ(variants.Size(), 1);
+    EXPECT_EQ(variants.Get(directory / "plain.frag"), plain);
+
+    FragmentShader* shader = variants.Get(directory / "main.frag", permutations[0]);
+    ASSERT_NE(shader, nullptr);
+    EXPECT_TRUE(shader->GetCompileStatus());
+    EXPECT_EQ(variants.Stats().misses, 8);
+
+    EXPECT_EQ(variants.Get(directory / "missing.frag"), nullptr);
+    EXPECT_FALSE(variants.GetError().empty());
+
+    std::filesystem::remove_all(directory);
+}
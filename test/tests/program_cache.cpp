@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <glwrap/include_gl.h>
+
+#ifdef GL_VERSION_4_1
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <glwrap/program_cache.hpp>
+
+using namespace glwrap;
+
+#define SUITE ProgramCache
+
+static const char* VERTEX_SOURCE =
+    "#version 330 core\n"
+    "void main() { gl_Position = vec4(0.0); }";
+
+static const char* FRAGMENT_SOURCE =
+    "#version 330 core\n"
+    "uniform vec4 tint;\n"
+    "out vec4 fragColor;\n"
+    "void main() { fragColor = tint; }";
+
+TEST(SUITE, Link)
+{
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats == 0) GTEST_SKIP() << "No program binary formats";
+
+    auto directory = std::filesystem::temp_directory_path() / "glwrap_program_cache";
+    std::filesystem::remove_all(directory);
+
+    ProgramCache cache(directory);
+    {
+        Program program;
+        VertexShader vertexShader;
+        FragmentShader fragmentShader;
+        vertexShader.Source(VERTEX_SOURCE);
+        fragmentShader.Source(FRAGMENT_SOURCE);
+        EXPECT_EQ(vertexShader.GetSource(), VERTEX_SOURCE);
+
+        EXPECT_TRUE(cache.Link(program, vertexShader, fragmentShader));
+        EXPECT_EQ(cache.Stats().misses, 1);
+    }
+    {
+        ShaderManager manager;
+        VertexShader vertexShader;
+        FragmentShader fragmentShader;
+        vertexShader.Source(VERTEX_SOURCE);
+        fragmentShader.Source(FRAGMENT_SOURCE);
+
+        EXPECT_TRUE(cache.Link(manager, vertexShader, fragmentShader));
+        EXPECT_EQ(cache.Stats().hits, 1);
+        EXPECT_FALSE(vertexShader.GetCompileStatus());
+
+        // uniforms are gathered from the loaded binary
+        EXPECT_EQ(manager.GetUniformCount(), 1);
+        EXPECT_NE(manager.GetUniformLocation("tint"), -1);
+    }
+    {
+        Program program;
+        VertexShader vertexShader;
+        FragmentShader fragmentShader;
+        vertexShader.Source(VERTEX_SOURCE);
+        fragmentShader.Source("#version 330 core\nout vec4 fragColor;\nvoid main() { fragColor = vec4(1.0); }");
+
+        EXPECT_TRUE(cache.Link(program, vertexShader, fragmentShader));
+        EXPECT_EQ(cache.Stats().misses, 2);
+    }
+
+    std::filesystem::remove_all(directory);
+}
+
+TEST(SUITE, Corrupt)
+{
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats == 0) GTEST_SKIP() << "No program binary formats";
+
+    auto directory = std::filesystem::temp_directory_path() / "glwrap_program_cache_corrupt";
+    std::filesystem::remove_all(directory);
+
+    ProgramCache cache(directory);
+    Program program;
+    VertexShader vertexShader;
+    FragmentShader fragmentShader;
+    vertexShader.Source(VERTEX_SOURCE);
+    fragmentShader.Source(FRAGMENT_SOURCE);
+    EXPECT_TRUE(cache.Link(program, vertexShader, fragmentShader));
+
+    // overwrite the binary's length in the header
+    for (const auto& entry : std::filesystem::directory_iterator(directory))
+    {
+        std::fstream file(entry.path(), std::ios::binary | std::ios::in | std::ios::out);
+        uint64_t length = UINT64_MAX / 2;
+        file.seekp(2 * sizeof(uint32_t) + sizeof(uint64_t));
+        file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    }
+
+    Program loaded;
+    EXPECT_FALSE(cache.Load(loaded, cache.Key(vertexShader, fragmentShader)));
+
+    std::filesystem::remove_all(directory);
+}
+#endif
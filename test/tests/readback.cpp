@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include <glwrap/include_gl.h>
+
+#ifdef GL_VERSION_3_2
+#include <glwrap/readback.hpp>
+
+using namespace glwrap;
+
+#define SUITE AsyncReadback
+
+TEST(SUITE, ReadTexture)
+{
+    Texture2D texture;
+    unsigned char pixels[2 * 2 * 4];
+    for (int i = 0; i < 16; i++) pixels[i] = static_cast<unsigned char>(i);
+    texture.Image(0, GL_RGBA8, 2, 2, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+    AsyncReadback readback(1);
+    AsyncReadback::Request request = readback.ReadTexture(texture, 0, GL_RGBA, GL_UNSIGNED_BYTE);
+    ASSERT_TRUE(request);
+    EXPECT_EQ(request.Size(), sizeof(pixels));
+    EXPECT_EQ(readback.Pending(), 1);
+
+    // the only buffer is in flight
+    EXPECT_FALSE(readback.ReadTexture(texture, 0, GL_RGBA, GL_UNSIGNED_BYTE));
+
+    unsigned char stored[sizeof(pixels)];
+    request.Get(stored);
+    EXPECT_TRUE(request.IsReady());
+    for (int i = 0; i < 16; i++) EXPECT_EQ(stored[i], pixels[i]);
+
+    request.Release();
+    EXPECT_EQ(readback.Pending(), 0);
+}
+#endif
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <glwrap/render_state.hpp>
+
+using namespace glwrap;
+
+#define SUITE RenderState
+
+TEST(SUITE, Cache)
+{
+    RenderState opaque;
+    opaque.depth.test = GL_TRUE;
+
+    RenderState blended = opaque;
+    blended.blend.enabled = GL_TRUE;
+    blended.blend.srcRGB = GL_SRC_ALPHA;
+    blended.blend.dstRGB = GL_ONE_MINUS_SRC_ALPHA;
+
+    EXPECT_NE(opaque.Hash(), blended.Hash());
+    EXPECT_EQ(opaque.Hash(), RenderState(opaque).Hash());
+
+    RenderStateCache cache;
+    const RenderState& first = cache.Get(opaque);
+    EXPECT_EQ(&cache.Get(blended), &cache.Get(blended));
+    EXPECT_EQ(&cache.Get(opaque), &first);
+    EXPECT_EQ(cache.Size(), 2);
+}
+
+TEST(SUITE, Apply)
+{
+    RenderState::Invalidate();
+    RenderState::ResetStats();
+
+    // the first state is applied in full
+    RenderState defaults;
+    defaults.Apply();
+    uint64_t full = RenderState::Stats().calls;
+    EXPECT_GT(full, 0);
+
+    defaults.Apply();
+    EXPECT_EQ(RenderState::Stats().skipped, 1);
+    EXPECT_EQ(RenderState::Stats().calls, full);
+
+    // only the difference is applied
+    RenderState depth = defaults;
+    depth.depth.test = GL_TRUE;
+    depth.depth.func = GL_LEQUAL;
+    depth.Apply();
+    EXPECT_EQ(RenderState::Stats().calls, full + 2);
+    EXPECT_TRUE(glIsEnabled(GL_DEPTH_TEST));
+
+    GLint func;
+    glGetIntegerv(GL_DEPTH_FUNC, &func);
+    EXPECT_EQ(func, GL_LEQUAL);
+
+    // functions of disabled tests are left alone
+    RenderState blend = defaults;
+    blend.blend.srcRGB = GL_SRC_ALPHA;
+    blend.Apply();
+    EXPECT_EQ(RenderState::Stats().calls, full + 3);
+
+    GLint src;
+    glGetIntegerv(GL_BLEND_SRC_RGB, &src);
+    EXPECT_EQ(src, GL_ONE);
+
+    blend.blend.enabled = GL_TRUE;
+    blend.Apply();
+    EXPECT_EQ(RenderState::Stats().calls, full + 5);
+    glGetIntegerv(GL_BLEND_SRC_RGB, &src);
+    EXPECT_EQ(src, GL_SRC_ALPHA);
+
+    // a zero viewport leaves the viewport unchanged
+    RenderState viewport = defaults;
+    viewport.viewport = {1, 2, 30, 40};
+    viewport.Apply();
+
+    GLint rect[4];
+    defaults.Apply();
+    glGetIntegerv(GL_VIEWPORT, rect);
+    EXPECT_EQ(rect[2], 30);
+    EXPECT_EQ(rect[3], 40);
+
+    // invalidating the binding cache applies the next state in full
+    uint64_t before = RenderState::Stats().calls;
+    BindingCache::Invalidate();
+    defaults.Apply();
+    EXPECT_EQ(RenderState::Stats().calls, before + full);
+    EXPECT_FALSE(glIsEnabled(GL_BLEND));
+    glGetIntegerv(GL_BLEND_SRC_RGB, &src);
+    EXPECT_EQ(src, GL_ONE);
+
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+}
@@ -1,4 +1,9 @@
 #include <gtest/gtest.h>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <glwrap/buffer.hpp>
+#include <glwrap/mapped_file.hpp>
 #include <glwrap/shader.hpp>
 
 using namespace glwrap;
@@ -40,6 +45,33 @@ TEST(SUITE, CompileShaderError)
     EXPECT_FALSE(shader.GetCompileStatus());
 }
 
+TEST(SUITE, CompileShaderStrings)
+{
+    std::string_view header = "#version 330 core\nconst float scale = 2.0;\n";
+    std::string_view body = "void main() { gl_Position = vec4(scale); }";
+
+    Shader<GL_VERTEX_SHADER> shader;
+    shader.Source({header, body.substr(0, body.size() - 1), "}"});
+
+    EXPECT_TRUE(shader.Compile());
+    EXPECT_EQ(shader.GetSource(), std::string(header) + std::string(body));
+}
+
+TEST(SUITE, CompileShaderFile)
+{
+    auto path = (std::filesystem::temp_directory_path() / "glwrap_shader.vert").string();
+    std::ofstream(path) <<
+        "#version 330 core\n"
+        "void main() { gl_Position = vec4(0.0); }";
+
+    Shader<GL_VERTEX_SHADER> shader;
+    EXPECT_TRUE(shader.SourceFile(path.c_str()));
+    EXPECT_TRUE(shader.Compile());
+
+    std::filesystem::remove(path);
+    EXPECT_FALSE(shader.SourceFile(path.c_str()));
+}
+
 TEST(SUITE, CreateProgram)
 {
     Program program;
@@ -138,4 +170,357 @@ TEST(SUITE, Manager)
         manager.GetUniformLocation("color"),
         manager.Program::GetUniformLocation("color")
     );
-}
\ No newline at end of file
+}
+
+TEST(SUITE, ManagerSet)
+{
+    ShaderManager manager;
+    VertexShader vertexShader;
+    FragmentShader fragmentShader;
+
+    vertexShader.Source(
+        "#version 330 core\n"
+        "uniform mat4 mvp;\n"
+        "void main() { gl_Position = mvp * vec4(1.0); }"
+    );
+
+    fragmentShader.Source(
+        "#version 330 core\n"
+        "uniform vec4 colors[2];\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = colors[0] + colors[1]; }"
+    );
+
+    EXPECT_TRUE(vertexShader.Compile());
+    EXPECT_TRUE(fragmentShader.Compile());
+    manager.Attach(vertexShader);
+    manager.Attach(fragmentShader);
+    EXPECT_TRUE(manager.Link());
+
+    ASSERT_NE(manager.GetUniform("colors"), nullptr);
+    EXPECT_EQ(manager.GetUniform("colors"), manager.GetUniform("colors[0]"));
+    EXPECT_EQ(manager.GetUniform("colors")->size, 2);
+    EXPECT_EQ(manager.GetUniform("missing"), nullptr);
+
+    GLfloat mvp[16] = {};
+    for (int i = 0; i < 16; i++) mvp[i] = static_cast<GLfloat>(i);
+    EXPECT_TRUE(manager.Set("mvp", mvp));
+    EXPECT_FALSE(manager.Set("mvp", 1.0f));
+    EXPECT_FALSE(manager.Set("missing", 1.0f));
+
+    GLfloat stored[16];
+    glGetUniformfv(manager.Handle(), manager.GetUniformLocation("mvp"), stored);
+    for (int i = 0; i < 16; i++) EXPECT_EQ(stored[i], mvp[i]);
+
+    GLfloat colors[2][4] = {{1, 2, 3, 4}, {5, 6, 7, 8}};
+    EXPECT_TRUE(manager.Set("colors", colors));
+    glGetUniformfv(manager.Handle(), manager.Program::GetUniformLocation("colors[1]"), stored);
+    EXPECT_EQ(stored[3], 8.0f);
+}
+
+TEST(SUITE, ManagerHandles)
+{
+    ShaderManager manager;
+    VertexShader vertexShader;
+    FragmentShader fragmentShader;
+
+    vertexShader.Source(
+        "#version 330 core\n"
+        "void main() { }"
+    );
+
+    fragmentShader.Source(
+        "#version 330 core\n"
+        "uniform vec3 tint;\n"
+        "uniform sampler2D image;\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = vec4(tint, 1.0) * texture(image, vec2(0.0)); }"
+    );
+
+    EXPECT_TRUE(vertexShader.Compile());
+    EXPECT_TRUE(fragmentShader.Compile());
+    manager.Attach(vertexShader);
+    manager.Attach(fragmentShader);
+    EXPECT_TRUE(manager.Link());
+
+    static_assert("tint"_uniform == Hash("tint"));
+
+    auto tint = manager.Resolve<std::array<GLfloat, 3>>("tint"_uniform);
+    ASSERT_TRUE(tint);
+    EXPECT_TRUE(manager.Set(tint, {0.5f, 0.25f, 1.0f}));
+
+    // vec4 for a vec3 is caught when resolving
+    auto wrong = manager.Resolve<std::array<GLfloat, 4>>("tint"_uniform);
+    EXPECT_FALSE(wrong);
+    std::array<GLint, 3> integers = {1, 2, 3};
+    EXPECT_FALSE(manager.Set("tint", integers));
+
+    auto image = manager.Resolve<GLint>("image"_uniform);
+    ASSERT_TRUE(image);
+    EXPECT_TRUE(manager.Set(image, 3));
+
+    GLint unit;
+    glGetUniformiv(manager.Handle(), manager.GetUniformLocation("image"), &unit);
+    EXPECT_EQ(unit, 3);
+
+    // linking again rebuilds the uniforms, so old handles are rejected
+    EXPECT_TRUE(manager.Link());
+    EXPECT_FALSE(manager.Set(image, 3));
+    image = manager.Resolve<GLint>("image"_uniform);
+    EXPECT_TRUE(manager.Set(image, 3));
+
+    // as is a handle from a manager that replaced the program, e.g. after a reload
+    ShaderManager original, replacement;
+    for (ShaderManager* program : {&original, &replacement})
+    {
+        program->Attach(vertexShader);
+        program->Attach(fragmentShader);
+        EXPECT_TRUE(program->Link());
+    }
+    EXPECT_FALSE(replacement.Set(original.Resolve<GLint>("image"_uniform), 3));
+    EXPECT_TRUE(replacement.Set(replacement.Resolve<GLint>("image"_uniform), 3));
+}
+
+TEST(SUITE, ManagerShadow)
+{
+    ShaderManager manager;
+    VertexShader vertexShader;
+    FragmentShader fragmentShader;
+
+    vertexShader.Source(
+        "#version 330 core\n"
+        "void main() { }"
+    );
+
+    fragmentShader.Source(
+        "#version 330 core\n"
+        "uniform float weights[4];\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = vec4(weights[0] + weights[1] + weights[2] + weights[3]); }"
+    );
+
+    EXPECT_TRUE(vertexShader.Compile());
+    EXPECT_TRUE(fragmentShader.Compile());
+    manager.Attach(vertexShader);
+    manager.Attach(fragmentShader);
+    EXPECT_TRUE(manager.Link());
+
+    GLfloat weights[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    EXPECT_TRUE(manager.Set("weights", weights));
+    EXPECT_TRUE(manager.Set("weights", weights));
+    EXPECT_EQ(manager.GetUniformStats().uploaded, 1);
+    EXPECT_EQ(manager.GetUniformStats().skipped, 1);
+
+    // unchanged elements are shadowed too
+    EXPECT_TRUE(manager.SetElements("weights", 2, 3.0f));
+    EXPECT_EQ(manager.GetUniformStats().skipped, 2);
+
+    EXPECT_TRUE(manager.SetElements("weights", 3, 5.0f));
+    EXPECT_FALSE(manager.SetElements("weights", 4, 5.0f));
+    EXPECT_EQ(manager.GetUniformStats().uploaded, 2);
+
+    GLfloat stored;
+    glGetUniformfv(manager.Handle(), manager.Program::GetUniformLocation("weights[3]"), &stored);
+    EXPECT_EQ(stored, 5.0f);
+
+    manager.InvalidateUniforms();
+    EXPECT_TRUE(manager.Set("weights", weights));
+    EXPECT_EQ(manager.GetUniformStats().uploaded, 3);
+}
+
+#ifdef GL_VERSION_3_1
+TEST(SUITE, UniformBlock)
+{
+    struct Camera
+    {
+        GLfloat view[16];
+        GLfloat position[3];
+        GLfloat exposure;
+        GLfloat weights[2][4];
+    };
+
+    Program program;
+    VertexShader vertexShader;
+    FragmentShader fragmentShader;
+
+    vertexShader.Source(
+        "#version 330 core\n"
+        "void main() { }"
+    );
+
+    fragmentShader.Source(
+        "#version 330 core\n"
+        "layout(std140) uniform Camera\n"
+        "{\n"
+        "    mat4 view;\n"
+        "    vec3 position;\n"
+        "    float exposure;\n"
+        "    float weights[2];\n"
+        "};\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = view * vec4(position, exposure + weights[0] + weights[1]); }"
+    );
+
+    EXPECT_TRUE(vertexShader.Compile());
+    EXPECT_TRUE(fragmentShader.Compile());
+    program.Attach(vertexShader);
+    program.Attach(fragmentShader);
+    EXPECT_TRUE(program.Link());
+
+    EXPECT_TRUE(program.BindUniformBlock("Camera", 2));
+    EXPECT_FALSE(program.BindUniformBlock("Light", 2));
+
+    UniformBlock block = program.GetUniformBlock("Camera");
+    ASSERT_NE(block.index, GL_INVALID_INDEX);
+    EXPECT_EQ(block.binding, 2);
+    EXPECT_EQ(block.size, 112);
+    ASSERT_NE(block.Find("weights[0]"), nullptr);
+    EXPECT_EQ(block.Find("weights[0]")->arrayStride, 16);
+    EXPECT_EQ(block.Find("view")->matrixStride, 16);
+
+    // std140 pads array elements to a vec4
+    EXPECT_TRUE(program.CheckUniformBlock<Camera>("Camera", {
+        {"view", offsetof(Camera, view), 0, 4 * sizeof(GLfloat)},
+        {"position", offsetof(Camera, position)},
+        {"exposure", offsetof(Camera, exposure)},
+        {"weights[0]", offsetof(Camera, weights), sizeof(Camera::weights[0])},
+    }));
+    EXPECT_FALSE(program.CheckUniformBlock<Camera>("Camera", {{"exposure", offsetof(Camera, position)}}));
+
+    // a tightly packed array matches the first element's offset, but not the stride
+    struct Packed
+    {
+        GLfloat view[16];
+        GLfloat position[3];
+        GLfloat exposure;
+        GLfloat weights[2];
+        GLfloat padding[6];
+    };
+    EXPECT_FALSE(program.CheckUniformBlock<Packed>("Camera", {
+        {"weights[0]", offsetof(Packed, weights), sizeof(Packed::weights[0])},
+    }));
+    EXPECT_FALSE(program.CheckUniformBlock<Camera>("Camera", {{"view", offsetof(Camera, view)}}));
+
+    UniformBuffer buffer;
+    Camera camera = {};
+    buffer.Store(sizeof(Camera), GL_DYNAMIC_DRAW, &camera);
+    buffer.BindBase(2);
+    EXPECT_TRUE(buffer.IsBound());
+
+    GLint bound;
+    glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, 2, &bound);
+    EXPECT_EQ(static_cast<GLuint>(bound), buffer.Handle());
+}
+#endif
+
+TEST(SUITE, Validate)
+{
+    ShaderManager manager;
+    VertexShader vertexShader;
+    FragmentShader fragmentShader;
+
+    vertexShader.Source(
+        "#version 330 core\n"
+        "void main() { gl_Position = vec4(0.0); }"
+    );
+
+    fragmentShader.Source(
+        "#version 330 core\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = vec4(1.0); }"
+    );
+
+    EXPECT_TRUE(vertexShader.Compile());
+    EXPECT_TRUE(fragmentShader.Compile());
+    manager.Attach(vertexShader);
+    manager.Attach(fragmentShader);
+
+    manager.SetLinkMode(LinkMode::Release);
+    EXPECT_TRUE(manager.Link());
+    EXPECT_FALSE(manager.GetValidateStatus());
+
+    manager.SetLinkMode(LinkMode::Debug);
+    EXPECT_TRUE(manager.Link());
+    EXPECT_TRUE(manager.GetValidateStatus());
+    EXPECT_TRUE(manager.Validate());
+}
+
+#ifdef GL_VERSION_4_1
+TEST(SUITE, ProgramPipeline)
+{
+    VertexStageProgram vertex(
+        "#version 410 core\n"
+        "out gl_PerVertex { vec4 gl_Position; };\n"
+        "void main() { gl_Position = vec4(0.0); }"
+    );
+    FragmentStageProgram red(
+        "#version 410 core\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = vec4(1.0, 0.0, 0.0, 1.0); }"
+    );
+    FragmentStageProgram green(
+        "#version 410 core\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = vec4(0.0, 1.0, 0.0, 1.0); }"
+    );
+    ASSERT_TRUE(vertex.GetLinkStatus()) << vertex.GetInfoLog();
+    EXPECT_TRUE(vertex.IsSeparable());
+
+    ProgramPipelineCache cache;
+    ProgramPipeline& first = cache.Get(vertex, red);
+    ProgramPipeline& second = cache.Get(vertex, green);
+    EXPECT_EQ(&cache.Get(vertex, red), &first);
+    EXPECT_NE(&first, &second);
+    EXPECT_EQ(cache.Size(), 2);
+
+    first.Bind();
+    EXPECT_TRUE(first.IsBound());
+    EXPECT_TRUE(first.Validate()) << first.GetInfoLog();
+
+    GLint stage;
+    glGetProgramPipelineiv(second.Handle(), GL_FRAGMENT_SHADER, &stage);
+    EXPECT_EQ(static_cast<GLuint>(stage), green.Handle());
+    first.Unbind();
+
+    cache.Remove(red);
+    EXPECT_EQ(cache.Size(), 1);
+}
+#endif
+
+#ifdef GL_VERSION_4_3
+#include <glwrap/sync.hpp>
+
+TEST(SUITE, Compute)
+{
+    Program program;
+    ComputeShader shader;
+    shader.Source(
+        "#version 430 core\n"
+        "layout(local_size_x = 4) in;\n"
+        "layout(std430, binding = 0) buffer Values { uint values[]; };\n"
+        "void main() { values[gl_GlobalInvocationID.x] += gl_GlobalInvocationID.x; }"
+    );
+    ASSERT_TRUE(shader.Compile()) << shader.GetInfoLog();
+    program.Attach(shader);
+    ASSERT_TRUE(program.Link()) << program.GetInfoLog();
+    EXPECT_EQ(program.GetWorkGroupSize()[0], 4);
+
+    GLuint zeros[8] = {};
+    ShaderStorageBuffer values;
+    values.Store(sizeof(zeros), GL_DYNAMIC_DRAW, zeros);
+    values.BindBase(0);
+
+    program.Dispatch(2);
+
+    GLuint counts[3] = {1, 1, 1};
+    DispatchIndirectBuffer indirect;
+    indirect.Store(sizeof(counts), GL_STATIC_DRAW, counts);
+
+    Barrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    program.DispatchIndirect(indirect);
+    Barrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    auto result = values.GetElements<GLuint>(0, 8);
+    for (GLuint i = 0; i < 8; i++) EXPECT_EQ(result[i], i < 4 ? 2 * i : i);
+}
+#endif
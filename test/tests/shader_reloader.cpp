@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <glwrap/shader_reloader.hpp>
+
+using namespace glwrap;
+
+#define SUITE ShaderReloader
+
+TEST(SUITE, Update)
+{
+    auto directory = std::filesystem::temp_directory_path() / "glwrap_shader_reloader";
+    std::filesystem::create_directories(directory);
+    std::ofstream(directory / "color.glsl") << "vec4 Color() { return vec4(1.0); }\n";
+    std::ofstream(directory / "main.vert") <<
+        "#version 330 core\n"
+        "void main() { gl_Position = vec4(0.0); }\n";
+    std::ofstream(directory / "main.frag") <<
+        "#version 330 core\n"
+        "#include \"color.glsl\"\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = Color(); }\n";
+    std::ofstream(directory / "other.frag") <<
+        "#version 330 core\n"
+        "out vec4 fragColor;\n"
+        "void main() { fragColor = vec4(0.0); }\n";
+
+    ShaderPreprocessor preprocessor;
+    ShaderReloader<ShaderManager> reloader(preprocessor);
+
+    size_t main = reloader.Add({
+        MakeShaderStage<GL_VERTEX_SHADER>(directory / "main.vert"),
+        MakeShaderStage<GL_FRAGMENT_SHADER>(directory / "main.frag"),
+    });
+    size_t other = reloader.Add({
+        MakeShaderStage<GL_VERTEX_SHADER>(directory / "main.vert"),
+        MakeShaderStage<GL_FRAGMENT_SHADER>(directory / "other.frag"),
+    });
+    ASSERT_NE(reloader.Get(main), nullptr);
+    ASSERT_NE(reloader.Get(other), nullptr);
+    EXPECT_EQ(reloader.Update(), 0);
+
+    // only the program including the changed file is rebuilt
+    ShaderManager* before = reloader.Get(main);
+    ShaderManager* untouched = reloader.Get(other);
+    std::ofstream(directory / "color.glsl") <<
+        "uniform vec4 tint;\n"
+        "vec4 Color() { return tint; }\n";
+    EXPECT_EQ(reloader.Update(), 1);
+    EXPECT_NE(reloader.Get(main), before);
+    EXPECT_EQ(reloader.Get(other), untouched);
+    EXPECT_NE(reloader.Get(main)->GetUniformLocation("tint"), -1);
+
+    // a broken edit keeps the previous program
+    before = reloader.Get(main);
+    std::ofstream(directory / "color.glsl") << "vec4 Color() { return tint }\n";
+    EXPECT_EQ(reloader.Update(), 0);
+    EXPECT_EQ(reloader.Get(main), before);
+    EXPECT_EQ(reloader.Errors().size(), 1);
+
+    std::ofstream(directory / "color.glsl") << "vec4 Color() { return vec4(0.5); }\n";
+    EXPECT_EQ(reloader.Update(), 1);
+    EXPECT_TRUE(reloader.Errors().empty());
+
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,44 @@
+#include <gtest/gtest.h>
+#include <glwrap/include_gl.h>
+
+#ifdef GL_VERSION_4_4
+#include <glwrap/streaming_buffer.hpp>
+
+using namespace glwrap;
+
+#define SUITE StreamingBuffer
+
+TEST(SUITE, Allocate)
+{
+    StreamingArrayBuffer buffer(256, 3);
+    EXPECT_EQ(buffer.Size(), 3 * 256);
+
+    auto a = buffer.Allocate(100);
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a.offset, 0);
+
+    auto b = buffer.Allocate(100, 64);
+    ASSERT_TRUE(b);
+    EXPECT_EQ(b.offset, 128);
+
+    EXPECT_FALSE(buffer.Allocate(100));
+}
+
+TEST(SUITE, Ring)
+{
+    StreamingArrayBuffer buffer(64, 2);
+
+    float data[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    auto a = buffer.Push(data, sizeof(data));
+    ASSERT_TRUE(a);
+
+    buffer.NextFrame();
+    EXPECT_EQ(buffer.CurrentRegion(), 1);
+    auto b = buffer.Allocate(16);
+    EXPECT_EQ(b.offset, 64);
+
+    buffer.NextFrame();
+    EXPECT_EQ(buffer.CurrentRegion(), 0);
+    EXPECT_EQ(buffer.Remaining(), 64);
+}
+#endif
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <glwrap/texture.hpp>
+
+using namespace glwrap;
+
+#define SUITE Texture
+
+TEST(SUITE, Create)
+{
+    Texture2D texture;
+
+    EXPECT_EQ(texture.BINDING, GL_TEXTURE_BINDING_2D);
+    EXPECT_EQ(texture.TARGET, GL_TEXTURE_2D);
+    EXPECT_NE(texture.Handle(), 0);
+}
+
+TEST(SUITE, Bind)
+{
+    Texture2D texture;
+
+    texture.Bind(1);
+    EXPECT_EQ(Texture2D::GetActiveUnit(), GL_TEXTURE1);
+    EXPECT_TRUE(texture.IsBound());
+
+    BindingCache::SetActiveUnit(0);
+    EXPECT_FALSE(texture.IsBound());
+}
+
+TEST(SUITE, SubImage)
+{
+    Texture2D texture;
+    texture.Image(0, GL_RGBA8, 2, 2, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    unsigned char texel[4] = {1, 2, 3, 4};
+    texture.SubImage(0, 1, 1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, texel);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+
+    unsigned char pixels[2 * 2 * 4];
+    texture.Bind();
+    glGetTexImage(Texture2D::TARGET, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    for (int i = 0; i < 4; i++) EXPECT_EQ(pixels[12 + i], texel[i]);
+}
+
+TEST(SUITE, Arrays)
+{
+    Texture2DArray array;
+    array.Image(0, GL_RGBA8, 2, 2, 3, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    EXPECT_EQ(array.GetLevelParameter(0, GL_TEXTURE_DEPTH), 3);
+
+    TextureCubeMap cube;
+    for (GLenum face = GL_TEXTURE_CUBE_MAP_POSITIVE_X; face <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z; face++)
+        cube.Image(face, 0, GL_RGBA8, 2, 2, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    unsigned char texel[4] = {1, 2, 3, 4};
+    cube.SubImage(GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, texel);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+
+    // level parameters of a cube map are those of its faces, also without direct state access
+    Features::SetDirectStateAccess(false);
+    TextureCubeMap bound;
+    Features::ResetDirectStateAccess();
+    for (GLenum face = GL_TEXTURE_CUBE_MAP_POSITIVE_X; face <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z; face++)
+        bound.Image(face, 0, GL_RGBA8, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    EXPECT_EQ(cube.GetLevelParameter(0, GL_TEXTURE_WIDTH), 2);
+    EXPECT_EQ(bound.GetLevelParameter(0, GL_TEXTURE_WIDTH), 4);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+}
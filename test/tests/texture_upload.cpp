@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <glwrap/include_gl.h>
+
+#ifdef GL_VERSION_4_4
+#include <cstring>
+#include <thread>
+
+#include <glwrap/texture_upload.hpp>
+
+using namespace glwrap;
+
+#define SUITE TextureUploader
+
+TEST(SUITE, Upload)
+{
+    Texture2D texture;
+    texture.Image(0, GL_RGBA8, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    TextureUploader uploader(2, 4 * 4 * 4);
+    EXPECT_FALSE(uploader.TryAcquire(4 * 4 * 4 + 1));
+
+    std::thread worker([&]
+    {
+        TextureUploader::Staging staging = uploader.Acquire(4 * 4 * 4);
+        ASSERT_TRUE(staging);
+        memset(staging.data, 0x7f, staging.size);
+        uploader.Submit(staging, texture, 0, 0, 0, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE);
+    });
+    worker.join();
+
+    EXPECT_EQ(uploader.Flush(), 1);
+    EXPECT_EQ(PixelUnpackBuffer::GetBound(), 0);
+
+    unsigned char pixels[4 * 4 * 4] = {};
+    texture.Bind();
+    glGetTexImage(Texture2D::TARGET, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    for (unsigned char pixel : pixels) EXPECT_EQ(pixel, 0x7f);
+}
+
+TEST(SUITE, Release)
+{
+    TextureUploader uploader(2, 64);
+
+    TextureUploader::Staging first = uploader.TryAcquire(64);
+    TextureUploader::Staging second = uploader.TryAcquire(64);
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_FALSE(uploader.TryAcquire(64));
+
+    // a released slot is reused without a flush
+    uploader.Release(second);
+    TextureUploader::Staging reused = uploader.TryAcquire(32);
+    ASSERT_TRUE(reused);
+    EXPECT_EQ(reused.slot, second.slot);
+    EXPECT_EQ(reused.size, 32);
+
+    uploader.Release({});
+    uploader.Release(first);
+    uploader.Release(reused);
+    EXPECT_TRUE(uploader.TryAcquire(64));
+}
+#endif
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <glwrap/buffer.hpp>
 #include <glwrap/vertex_array.hpp>
 
 using namespace glwrap;
@@ -22,4 +23,61 @@ TEST(SUITE, Bind)
     EXPECT_EQ(VertexArray::GetBound(), vao.Handle());
     vao.Unbind();
     EXPECT_EQ(VertexArray::GetBound(), 0);
-}
\ No newline at end of file
+}
+
+TEST(SUITE, DefineAttribute)
+{
+    VertexArray vao;
+    ArrayBuffer vbo;
+
+    vbo.Initialize(6 * sizeof(float), GL_STATIC_DRAW);
+    vbo.Bind();
+    vao.DefineAttribute(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+}
+
+TEST(SUITE, PackedAttribute)
+{
+    static_assert(GetAttributeSize(3, GL_FLOAT) == 12);
+    static_assert(GetAttributeSize(GL_BGRA, GL_UNSIGNED_BYTE) == 4);
+    static_assert(GetAttributeSize(3, GL_UNSIGNED_INT_10F_11F_11F_REV) == 4);
+    static_assert(GetAttributeSize(4, GL_UNSIGNED_INT_2_10_10_10_REV) == 4);
+
+    VertexArray vao;
+    ArrayBuffer vbo;
+
+    vbo.Initialize(4 * sizeof(GLuint), GL_STATIC_DRAW);
+    vbo.Bind();
+    vao.DefineAttribute(0, 4, GL_UNSIGNED_INT_2_10_10_10_REV, GL_TRUE, 0, 0);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+
+#ifdef GL_VERSION_4_3
+    // the direct path spells out the tightly packed stride
+    if (vao.IsDirect())
+    {
+        GLint stride = 0;
+        vao.Bind();
+        glGetIntegeri_v(GL_VERTEX_BINDING_STRIDE, 0, &stride);
+        EXPECT_EQ(stride, 4);
+        vao.Unbind();
+    }
+#endif
+}
+
+TEST(SUITE, BindElementBuffer)
+{
+    VertexArray vao;
+    ElementArrayBuffer first, second;
+    first.Initialize(4 * sizeof(GLuint), GL_STATIC_DRAW);
+    second.Initialize(4 * sizeof(GLuint), GL_STATIC_DRAW);
+
+    vao.Bind();
+    vao.BindElementBuffer(first);
+    vao.BindElementBuffer(second);
+    first.Bind();
+
+    GLint bound;
+    glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &bound);
+    EXPECT_EQ(static_cast<GLuint>(bound), first.Handle());
+    vao.Unbind();
+}
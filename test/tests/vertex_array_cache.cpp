@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <glwrap/vertex_array_cache.hpp>
+
+using namespace glwrap;
+
+#define SUITE VertexArrayCache
+
+using Vec3 = std::array<GLfloat, 3>;
+using Simple = VertexLayout<Position<Vec3>>;
+using Lit = VertexLayout<Position<Vec3>, Normal<Vec3>>;
+
+TEST(SUITE, Get)
+{
+    ArrayBuffer shared, other;
+    ElementArrayBuffer indices;
+    shared.Initialize(64 * Lit::STRIDE, GL_STATIC_DRAW);
+    other.Initialize(64 * Lit::STRIDE, GL_STATIC_DRAW);
+    indices.Initialize(64 * sizeof(GLuint), GL_STATIC_DRAW);
+
+    VertexArrayCache cache(2);
+    VertexArray& first = cache.Get<Lit>(shared, &indices);
+    EXPECT_EQ(&cache.Get<Lit>(shared, &indices), &first);
+    EXPECT_NE(&cache.Get<Simple>(shared, &indices), &first);
+    EXPECT_EQ(cache.Stats().hits, 1);
+    EXPECT_EQ(cache.Stats().misses, 2);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+
+    first.Bind();
+    EXPECT_EQ(ElementArrayBuffer::GetBound(), indices.Handle());
+    first.Unbind();
+
+    // the least recently used layout is evicted
+    cache.Get<Lit>(shared, &indices);
+    cache.Get<Lit>(other);
+    EXPECT_EQ(cache.Size(), 2);
+    EXPECT_EQ(cache.Stats().evictions, 1);
+    cache.Get<Lit>(shared, &indices);
+    EXPECT_EQ(cache.Stats().hits, 3);
+
+    cache.Remove(indices.Handle());
+    EXPECT_EQ(cache.Size(), 1);
+}
+
+TEST(SUITE, Collision)
+{
+    std::vector<std::unique_ptr<ArrayBuffer>> vertexBuffers;
+    std::vector<std::unique_ptr<ElementArrayBuffer>> elementBuffers;
+    for (int i = 0; i < 64; i++)
+    {
+        vertexBuffers.push_back(std::make_unique<ArrayBuffer>());
+        elementBuffers.push_back(std::make_unique<ElementArrayBuffer>());
+    }
+
+    // find two buffer pairs with the same key, e.g. (2, 63) and (1, 0)
+    std::vector<ElementArrayBuffer*> elements = {nullptr};
+    for (auto& e : elementBuffers) elements.push_back(e.get());
+    auto key = [](const ArrayBuffer& v, const ElementArrayBuffer* e)
+    {
+        return HashCombine(HashCombine(Lit::HASH, v.Handle()), e ? e->Handle() : 0);
+    };
+    std::unordered_map<uint64_t, std::pair<ArrayBuffer*, ElementArrayBuffer*>> seen;
+    std::pair<ArrayBuffer*, ElementArrayBuffer*> first = {}, second = {};
+    for (auto& v : vertexBuffers)
+    {
+        for (ElementArrayBuffer* e : elements)
+        {
+            auto [it, inserted] = seen.emplace(key(*v, e), std::make_pair(v.get(), e));
+            if (inserted || first.first || it->second.first == v.get()) continue;
+
+            first = it->second;
+            second = {v.get(), e};
+        }
+    }
+    if (!first.first) GTEST_SKIP() << "No colliding handles were generated";
+
+    VertexArrayCache cache;
+    VertexArray& a = cache.Get<Lit>(*first.first, first.second);
+    VertexArray& b = cache.Get<Lit>(*second.first, second.second);
+    EXPECT_NE(&a, &b);
+    EXPECT_EQ(cache.Stats().misses, 2);
+
+    b.Bind();
+    EXPECT_EQ(ElementArrayBuffer::GetBound(), second.second ? second.second->Handle() : 0);
+    b.Unbind();
+
+    cache.Remove(first.first->Handle());
+    EXPECT_EQ(&cache.Get<Lit>(*second.first, second.second), &b);
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <glwrap/vertex_layout.hpp>
+
+using namespace glwrap;
+
+#define SUITE VertexLayout
+
+using Vec2 = std::array<GLfloat, 2>;
+using Vec3 = std::array<GLfloat, 3>;
+using Mesh = VertexLayout<Position<Vec3>, Normal<Vec3>, UV<Vec2>, Color<std::array<GLubyte, 4>>>;
+
+static_assert(Mesh::STRIDE == 36);
+static_assert(Mesh::OFFSETS[2] == 24);
+static_assert(Mesh::OffsetOf(3) == 32);
+static_assert(Mesh::OffsetOf(7) == Mesh::STRIDE);
+static_assert(Mesh::HASH == VertexLayout<Position<Vec3>, Normal<Vec3>, UV<Vec2>, Color<std::array<GLubyte, 4>>>::HASH);
+static_assert(Mesh::HASH != VertexLayout<Position<Vec3>, UV<Vec2>>::HASH);
+
+using Skinned = VertexLayout<Position<Vec3>, IntegerAttribute<std::array<GLint, 4>, 5>>;
+static_assert(Skinned::HASH != VertexLayout<Position<Vec3>, Attribute<std::array<GLint, 4>, 5>>::HASH);
+
+TEST(SUITE, Define)
+{
+    VertexArray vao;
+    ArrayBuffer vbo;
+    vbo.Initialize(3 * Mesh::STRIDE, GL_STATIC_DRAW);
+    vbo.Bind();
+
+    Mesh::Define(vao);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+
+    vao.Bind();
+    GLint enabled, buffer;
+    glGetVertexAttribiv(2, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &enabled);
+    EXPECT_EQ(enabled, GL_TRUE);
+    glGetVertexAttribiv(3, GL_VERTEX_ATTRIB_ARRAY_NORMALIZED, &enabled);
+    EXPECT_EQ(enabled, GL_TRUE);
+    glGetVertexAttribiv(1, GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING, &buffer);
+    EXPECT_EQ(static_cast<GLuint>(buffer), vbo.Handle());
+    vao.Unbind();
+}
+
+TEST(SUITE, DefineInteger)
+{
+    VertexArray vao;
+    ArrayBuffer vbo;
+    vbo.Initialize(3 * Skinned::STRIDE, GL_STATIC_DRAW);
+    vbo.Bind();
+
+    Skinned::Define(vao);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+
+    vao.Bind();
+    GLint integer;
+    glGetVertexAttribiv(5, GL_VERTEX_ATTRIB_ARRAY_INTEGER, &integer);
+    EXPECT_EQ(integer, GL_TRUE);
+    glGetVertexAttribiv(0, GL_VERTEX_ATTRIB_ARRAY_INTEGER, &integer);
+    EXPECT_EQ(integer, GL_FALSE);
+    vao.Unbind();
+}
+
+#ifdef GL_VERSION_4_3
+TEST(SUITE, Apply)
+{
+    VertexArray vao;
+    ArrayBuffer first, second;
+    first.Initialize(3 * Mesh::STRIDE, GL_STATIC_DRAW);
+    second.Initialize(3 * Mesh::STRIDE, GL_STATIC_DRAW);
+
+    Mesh::Apply(vao, 1);
+    Mesh::BindVertexBuffer(vao, first, 0, 1);
+    Mesh::BindVertexBuffer(vao, second, 2, 1);
+    EXPECT_EQ(glGetError(), GL_NO_ERROR);
+
+    vao.Bind();
+    GLint value;
+    glGetVertexAttribiv(2, GL_VERTEX_ATTRIB_RELATIVE_OFFSET, &value);
+    EXPECT_EQ(value, 24);
+    glGetVertexAttribiv(0, GL_VERTEX_ATTRIB_BINDING, &value);
+    EXPECT_EQ(value, 1);
+    glGetVertexAttribiv(0, GL_VERTEX_ATTRIB_ARRAY_ENABLED, &value);
+    EXPECT_EQ(value, GL_TRUE);
+    glGetIntegeri_v(GL_VERTEX_BINDING_BUFFER, 1, &value);
+    EXPECT_EQ(static_cast<GLuint>(value), second.Handle());
+    glGetIntegeri_v(GL_VERTEX_BINDING_OFFSET, 1, &value);
+    EXPECT_EQ(value, 2 * Mesh::STRIDE);
+    vao.Unbind();
+}
+#endif